@@ -65,6 +65,11 @@ static bool has_infile = false;
 static cmd_func_t quit_helpers[MAXQUIT];
 static int quit_helper_cnt = 0;
 
+/* Optional functions to call after every command */
+#define MAXHELPER 10
+static cmd_func_t cmd_helpers[MAXHELPER];
+static int cmd_helper_cnt = 0;
+
 static void init_in();
 
 static bool push_file(char *fname);
@@ -212,6 +217,8 @@ static bool interpret_cmda(int argc, char *argv[])
         next_cmd = next_cmd->next;
     if (next_cmd) {
         ok = next_cmd->operation(argc, argv);
+        for (int i = 0; i < cmd_helper_cnt; i++)
+            ok = cmd_helpers[i](argc, argv) && ok;
         if (!ok)
             record_error();
     } else {
@@ -248,6 +255,15 @@ void add_quit_helper(cmd_func_t qf)
         report_event(MSG_FATAL, "Exceeded limit on quit helpers");
 }
 
+/* Set function to be executed after every command */
+void add_cmd_helper(cmd_func_t hf)
+{
+    if (cmd_helper_cnt < MAXHELPER)
+        cmd_helpers[cmd_helper_cnt++] = hf;
+    else
+        report_event(MSG_FATAL, "Exceeded limit on command helpers");
+}
+
 /* Turn echoing on/off */
 void set_echo(bool on)
 {
@@ -56,6 +56,11 @@ bool get_int(char *vname, int *loc);
 /* Add function to be executed as part of program exit */
 void add_quit_helper(cmd_func_t qf);
 
+/* Add function to be executed after every command, with its arguments.
+ * Returning false counts as an error of the command.
+ */
+void add_cmd_helper(cmd_func_t hf);
+
 /* Turn echoing on/off */
 void set_echo(bool on);
 
@@ -5,6 +5,7 @@
 #include "constant.h"
 #include "cpucycles.h"
 #include "queue.h"
+#include "queue_ext.h"
 #include "random.h"
 
 /* Maintain a queue independent from the qtest since
@@ -36,6 +37,20 @@ static struct list_head *l = NULL;
 
 #define dut_free() ((void) (q_free(l)))
 
+/* The same for ring buffer queues */
+static ring_t *r = NULL;
+
+#define dut_ring_new() ((void) (r = q_ring_new()))
+
+#define dut_ring_insert_head(s, n)    \
+    do {                              \
+        int j = n;                    \
+        while (j--)                   \
+            q_ring_insert_head(r, s); \
+    } while (0)
+
+#define dut_ring_free() ((void) (q_ring_free(r)))
+
 static char random_string[N_MEASURES][8];
 static int random_string_iter = 0;
 
@@ -43,6 +58,7 @@ static int random_string_iter = 0;
 void init_dut(void)
 {
     l = NULL;
+    r = NULL;
 }
 
 static char *get_random_string(void)
@@ -73,7 +89,10 @@ bool measure(int64_t *before_ticks,
              int mode)
 {
     assert(mode == DUT(insert_head) || mode == DUT(insert_tail) ||
-           mode == DUT(remove_head) || mode == DUT(remove_tail));
+           mode == DUT(remove_head) || mode == DUT(remove_tail) ||
+           mode == DUT(size) || mode == DUT(ring_insert_head) ||
+           mode == DUT(ring_insert_tail) || mode == DUT(ring_remove_head) ||
+           mode == DUT(ring_remove_tail) || mode == DUT(ring_size));
 
     switch (mode) {
     case DUT(insert_head):
@@ -146,6 +165,60 @@ bool measure(int64_t *before_ticks,
                 return false;
         }
         break;
+    case DUT(ring_insert_head):
+    case DUT(ring_insert_tail):
+        for (size_t i = 0; i < N_MEASURES; i++) {
+            char *s = get_random_string();
+            dut_ring_new();
+            dut_ring_insert_head(
+                get_random_string(),
+                *(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000);
+            int before_size = q_ring_size(r);
+            before_ticks[i] = cpucycles();
+            if (mode == DUT(ring_insert_head))
+                q_ring_insert_head(r, s);
+            else
+                q_ring_insert_tail(r, s);
+            after_ticks[i] = cpucycles();
+            int after_size = q_ring_size(r);
+            dut_ring_free();
+            if (before_size != after_size - 1)
+                return false;
+        }
+        break;
+    case DUT(ring_remove_head):
+    case DUT(ring_remove_tail):
+        for (size_t i = 0; i < N_MEASURES; i++) {
+            dut_ring_new();
+            dut_ring_insert_head(
+                get_random_string(),
+                *(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000 + 1);
+            int before_size = q_ring_size(r);
+            before_ticks[i] = cpucycles();
+            if (mode == DUT(ring_remove_head))
+                q_ring_remove_head(r, NULL, 0);
+            else
+                q_ring_remove_tail(r, NULL, 0);
+            after_ticks[i] = cpucycles();
+            int after_size = q_ring_size(r);
+            dut_ring_free();
+            if (before_size != after_size + 1)
+                return false;
+        }
+        break;
+    case DUT(ring_size):
+        for (size_t i = 0; i < N_MEASURES; i++) {
+            dut_ring_new();
+            dut_ring_insert_head(
+                get_random_string(),
+                *(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000);
+            before_ticks[i] = cpucycles();
+            q_ring_size(r);
+            after_ticks[i] = cpucycles();
+            dut_ring_free();
+        }
+        break;
+    case DUT(size):
     default:
         for (size_t i = 0; i < N_MEASURES; i++) {
             dut_new();
@@ -1,5 +1,11 @@
 /* Test support code */
 
+/* dladdr() and Dl_info are GNU extensions on Linux */
+#if defined(__linux__) || defined(__GNU__)
+#define _GNU_SOURCE
+#endif
+
+#include <pthread.h>
 #include <setjmp.h>
 #include <signal.h>
 #include <stdint.h>
@@ -8,6 +14,19 @@
 #include <string.h>
 #include <unistd.h>
 
+#if defined(__linux__) || defined(__APPLE__)
+#include <dlfcn.h>
+#define HAVE_DLADDR 1
+#endif
+
+#if defined(__linux__)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#define malloc_usable_size malloc_size
+#endif
+
+#include "random.h"
 #include "report.h"
 
 /* Our program needs to use regular malloc/free */
@@ -30,34 +49,128 @@
 
 /* Data structures used by our code */
 
-/* Represent allocated blocks as doubly-linked list, with
- * next and prev pointers at beginning
- */
+/* Allocations made from one call site of test_malloc() and friends */
+typedef struct {
+    const void *caller; /* Return address, NULL if the entry is unused */
+    size_t allocs;      /* Blocks ever allocated */
+    size_t live;        /* Blocks still allocated */
+    size_t live_bytes;
+    size_t peak_bytes; /* Largest value live_bytes has had */
+} alloc_site_t;
+
+/* Header of every allocated block */
 typedef struct __block_element {
-    struct __block_element *next, *prev;
+    alloc_site_t *site;
     size_t payload_size;
+    size_t slab_class; /* Size class of owning slab, 0 if from malloc */
     size_t magic_header; /* Marker to see if block seems legitimate */
     unsigned char payload[0];
     /* Also place magic number at tail of every block */
 } block_element_t;
 
-static block_element_t *allocated = NULL;
-static size_t allocated_count = 0;
+/* Registry of allocated blocks: an open-addressing hash table of their
+ * addresses with linear probing.  It grows to keep at most half of its
+ * slots in use, and removal moves later entries of the probe run back
+ * instead of leaving tombstones, so a lookup takes O(1) expected time.
+ */
+#define REGISTRY_MIN_BITS 10
+
+/* Call sites, in an open-addressing hash table of their return addresses.
+ * The few sites left over once it is full share site_overflow.
+ */
+#define SITE_BITS 9
+#define SITE_SLOTS (1 << SITE_BITS)
+
+static alloc_site_t sites[SITE_SLOTS];
+static size_t site_count = 0;
+static alloc_site_t site_overflow;
+
+/* Small blocks (e.g., element_t and short strings) are carved out of
+ * SLAB_SIZE-aligned slabs instead of going to malloc one at a time.  Every
+ * slab serves a single size class, and freed slots are recycled through a
+ * per-slab free list.  Headers, footers and the registry are kept exactly
+ * as for malloc-backed blocks, so leak and corruption checks see no
+ * difference.
+ */
+#define SLAB_SIZE (64 * 1024)
+#define SLAB_GRAIN 16
+#define SLAB_MAX_BLOCK 128
+#define SLAB_CLASSES (SLAB_MAX_BLOCK / SLAB_GRAIN)
+
+typedef struct __slab {
+    struct __slab *next, *prev; /* Slabs of this class having free slots */
+    void *free_slots;           /* Recycled slots, linked through 1st word */
+    size_t bump;                /* Offset of first never-used slot */
+    size_t in_use;
+    size_t slot_size;
+    bool listed;
+} slab_t;
+
+#define SLAB_FIRST_SLOT \
+    ((sizeof(slab_t) + SLAB_GRAIN - 1) & ~(size_t) (SLAB_GRAIN - 1))
+
+/* Allocator state of a thread.  Each thread registers its blocks in its
+ * own shard and carves them out of its own slabs, so the lock of a shard is
+ * only contended by threads freeing blocks another thread allocated.  Past
+ * MAX_SHARDS threads, shards are shared.
+ */
+#define MAX_SHARDS 16
+
+typedef struct {
+    pthread_mutex_t lock;
+    block_element_t **registry;
+    unsigned registry_bits;
+    size_t allocated_count;
+    size_t free_count;
+    /* Per size class: slabs with room left, and one spare kept when emptied */
+    slab_t *partial_slabs[SLAB_CLASSES + 1];
+    slab_t *spare_slabs[SLAB_CLASSES + 1];
+    /* Requests served, by log2 of the size requested */
+    alloc_stats_t size_stats[ALLOC_BUCKETS];
+} shard_t;
+
+static shard_t shards[MAX_SHARDS];
+static unsigned shard_count = 0; /* Threads given a shard so far */
+static pthread_once_t shards_once = PTHREAD_ONCE_INIT;
+static __thread shard_t *self_shard = NULL;
+
+/* Whether small blocks are served from slabs */
+int slab_pool = 1;
 
 /* Percent probability of malloc failure */
 int fail_probability = 0;
 
-static bool cautious_mode = true;
+/* Sampling of the checks that touch more of a block than its header: 0 to
+ * run them on every free, N to run them on every Nth free only and to
+ * sweep 1/N of the allocated blocks with allocation_sweep()
+ */
+int cautious_rate = 0;
 static bool noallocate_mode = false;
+
+/* Set by any thread, cleared by error_check() */
 static bool error_occurred = false;
-static char *error_message = "";
+#define flag_error() __atomic_store_n(&error_occurred, true, __ATOMIC_RELAXED)
 
-static int time_limit = 1;
+int time_limit = 1;
 
-/* Data for managing exceptions */
-static jmp_buf env;
-static volatile sig_atomic_t jmp_ready = false;
-static bool time_limited = false;
+/* Data for managing exceptions, kept per thread.  alarm() is per process,
+ * so the thread that set the time limit is recorded to pass it SIGALRM
+ * should another thread receive it.
+ */
+static __thread sigjmp_buf env;
+static __thread volatile sig_atomic_t jmp_ready = false;
+static __thread bool time_limited = false;
+static __thread char *error_message = "";
+static pthread_t alarm_thread;
+static volatile sig_atomic_t alarm_set = false;
+
+/* Locks held by the thread, shard locks or those libc takes inside calls
+ * like random() and fprintf(), and the message of an exception held back
+ * until they are released: jumping out would leave a lock held and the
+ * shard half updated.
+ */
+static __thread volatile sig_atomic_t locks_held = 0;
+static __thread char *volatile deferred_message = NULL;
 
 /* For test_malloc and test_calloc */
 typedef enum {
@@ -75,32 +188,203 @@ static bool fail_allocation()
     return (weight < 0.01 * fail_probability);
 }
 
-/* Find header of block, given its payload.
- * Signal error if doesn't seem like legitimate block
+static void shards_init(void)
+{
+    for (int i = 0; i < MAX_SHARDS; i++)
+        pthread_mutex_init(&shards[i].lock, NULL);
+}
+
+/* Shard of the calling thread */
+static shard_t *shard_self(void)
+{
+    if (!self_shard) {
+        pthread_once(&shards_once, shards_init);
+        unsigned i = __atomic_fetch_add(&shard_count, 1, __ATOMIC_RELAXED);
+        self_shard = &shards[i % MAX_SHARDS];
+    }
+    return self_shard;
+}
+
+/* Hold back exceptions until the matching exceptions_release() */
+static inline void exceptions_hold(void)
+{
+    locks_held++;
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+/* End the innermost exceptions_hold(), and return the message of any
+ * exception held back that is now due, leaving it to the caller to raise
+ */
+static inline char *exceptions_release(void)
+{
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    char *msg = NULL;
+    if (!--locks_held && deferred_message) {
+        msg = deferred_message;
+        deferred_message = NULL;
+    }
+    return msg;
+}
+
+/* Take the lock of shard s, holding back exceptions until it is released */
+static inline void shard_lock(shard_t *s)
+{
+    exceptions_hold();
+    pthread_mutex_lock(&s->lock);
+}
+
+/* Release the lock of shard s, and return the message of any exception
+ * held back that is now due, leaving it to the caller to raise
+ */
+static inline char *shard_release(shard_t *s)
+{
+    pthread_mutex_unlock(&s->lock);
+    return exceptions_release();
+}
+
+/* Release the lock of shard s, then raise any exception held back */
+static inline void shard_unlock(shard_t *s)
+{
+    char *msg = shard_release(s);
+    if (msg)
+        trigger_exception(msg);
+}
+
+/* Number of shards any thread has used */
+static unsigned shards_used(void)
+{
+    unsigned n = __atomic_load_n(&shard_count, __ATOMIC_RELAXED);
+    return n < MAX_SHARDS ? n : MAX_SHARDS;
+}
+
+/* Home slot of block b in the registry.  Blocks are 16-byte aligned, and
+ * those of one 4 KiB page keep their order within a window of 256 slots, so
+ * blocks allocated together share cache lines of the table as well.  The
+ * windows are placed by Fibonacci hashing of the page number.
+ */
+static inline size_t registry_hash(unsigned bits, const block_element_t *b)
+{
+    uintptr_t u = (uintptr_t) b >> 4;
+    uint64_t page = (uint64_t) (u >> 8) * UINT64_C(0x9e3779b97f4a7c15);
+    return (size_t) ((page >> (72 - bits)) << 8 | (u & 255));
+}
+
+/* Slot of a table of 2^bits slots holding b, or the empty slot ending its
+ * probe run
  */
-static block_element_t *find_header(void *p)
+static size_t registry_probe(block_element_t *const *table,
+                             unsigned bits,
+                             const block_element_t *b)
+{
+    size_t mask = ((size_t) 1 << bits) - 1;
+    size_t i = registry_hash(bits, b);
+    while (table[i] && table[i] != b)
+        i = (i + 1) & mask;
+    return i;
+}
+
+/* Slot of the registry holding b, or the empty slot ending its probe run */
+static inline size_t registry_find(const shard_t *s, const block_element_t *b)
+{
+    return registry_probe(s->registry, s->registry_bits, b);
+}
+
+/* Make room in the registry for one more block.  The table is managed with
+ * the regular malloc, so it does not show up in allocation_check().
+ */
+static bool registry_reserve(shard_t *s)
+{
+    size_t size = s->registry ? (size_t) 1 << s->registry_bits : 0;
+    if (2 * (s->allocated_count + 1) <= size)
+        return true;
+
+    unsigned bits = s->registry ? s->registry_bits + 1 : REGISTRY_MIN_BITS;
+    block_element_t **table = calloc((size_t) 1 << bits, sizeof(*table));
+    if (!table)
+        return false;
+
+    /* Only switch to the new table once it holds every block */
+    block_element_t **old = s->registry;
+    for (size_t i = 0; i < size; i++) {
+        if (old[i])
+            table[registry_probe(table, bits, old[i])] = old[i];
+    }
+    s->registry = table;
+    s->registry_bits = bits;
+    free(old);
+    return true;
+}
+
+/* Remove the block in slot i of the registry */
+static void registry_remove(shard_t *s, size_t i)
+{
+    block_element_t **registry = s->registry;
+    size_t mask = ((size_t) 1 << s->registry_bits) - 1;
+    for (size_t j = (i + 1) & mask; registry[j]; j = (j + 1) & mask) {
+        /* The entry in slot j stays unless its home slot lies cyclically
+         * outside (i, j], in which case it would no longer be found.
+         */
+        size_t k = registry_hash(s->registry_bits, registry[j]);
+        if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+            continue;
+        registry[i] = registry[j];
+        i = j;
+    }
+    registry[i] = NULL;
+    s->allocated_count--;
+
+    /* Give a large table back once every block is freed */
+    if (!s->allocated_count && s->registry_bits > REGISTRY_MIN_BITS) {
+        free(registry);
+        s->registry = NULL;
+    }
+}
+
+/* Find the shard registering block b, starting with that of the calling
+ * thread, and return it locked, with the slot holding b in *slot.  NULL if
+ * b is not allocated.
+ */
+static shard_t *shard_of(const block_element_t *b, size_t *slot)
+{
+    shard_t *self = shard_self();
+    unsigned n = shards_used();
+    for (unsigned k = 0; k <= n; k++) {
+        shard_t *s = k ? &shards[k - 1] : self;
+        if (k && s == self)
+            continue;
+        shard_lock(s);
+        if (s->registry) {
+            *slot = registry_find(s, b);
+            if (s->registry[*slot])
+                return s;
+        }
+        shard_unlock(s);
+    }
+    return NULL;
+}
+
+/* Find header of block, given its payload, and return it with the shard
+ * registering it locked in *shard and its slot in *slot.  Return NULL and
+ * signal error if it is not allocated, and signal error if it doesn't seem
+ * like legitimate block.  The registry lookup costs O(1), so every free is
+ * checked.
+ */
+static block_element_t *find_header(void *p, shard_t **shard, size_t *slot)
 {
     if (!p) {
         report_event(MSG_ERROR, "Attempting to free null block");
-        error_occurred = true;
+        flag_error();
     }
 
     block_element_t *b =
         (block_element_t *) ((size_t) p - sizeof(block_element_t));
-    if (cautious_mode) {
-        /* Make sure this is really an allocated block */
-        block_element_t *ab = allocated;
-        bool found = false;
-        while (ab && !found) {
-            found = ab == b;
-            ab = ab->next;
-        }
-        if (!found) {
-            report_event(MSG_ERROR,
-                         "Attempted to free unallocated block.  Address = %p",
-                         p);
-            error_occurred = true;
-        }
+    /* Make sure this is really an allocated block before looking at it */
+    *shard = shard_of(b, slot);
+    if (!*shard) {
+        report_event(MSG_ERROR,
+                     "Attempted to free unallocated block.  Address = %p", p);
+        flag_error();
+        return NULL;
     }
 
     if (b->magic_header != MAGICHEADER) {
@@ -108,12 +392,35 @@ static block_element_t *find_header(void *p)
             MSG_ERROR,
             "Attempted to free unallocated or corrupted block.  Address = %p",
             p);
-        error_occurred = true;
+        flag_error();
     }
 
     return b;
 }
 
+/* Whether the payload size in the header of b fits the memory it was
+ * carved out of, so its footer can be looked at.  Shard s registers b.
+ */
+static bool payload_fits(const shard_t *s, const block_element_t *b)
+{
+    size_t total = b->payload_size + sizeof(block_element_t) + sizeof(size_t);
+    if (total < b->payload_size)
+        return false;
+    if (b->slab_class)
+        return b->slab_class <= SLAB_CLASSES &&
+               total <= b->slab_class * SLAB_GRAIN;
+#if defined(__linux__) || defined(__APPLE__)
+    (void) s;
+    return total <= malloc_usable_size((void *) b);
+#else
+    /* No block is larger than the largest request the shard served */
+    int i = ALLOC_BUCKETS - 1;
+    while (i && !s->size_stats[i].requests)
+        i--;
+    return i == ALLOC_BUCKETS - 1 || b->payload_size < (size_t) 1 << i;
+#endif
+}
+
 /* Given pointer to block, find its footer */
 static size_t *find_footer(block_element_t *b)
 {
@@ -123,7 +430,124 @@ static size_t *find_footer(block_element_t *b)
     return p;
 }
 
-static void *alloc(alloc_t alloc_type, size_t size)
+static void slab_link(shard_t *s, slab_t *slab, size_t cls)
+{
+    slab->prev = NULL;
+    slab->next = s->partial_slabs[cls];
+    if (slab->next)
+        slab->next->prev = slab;
+    s->partial_slabs[cls] = slab;
+    slab->listed = true;
+}
+
+static void slab_unlink(shard_t *s, slab_t *slab, size_t cls)
+{
+    if (slab->prev)
+        slab->prev->next = slab->next;
+    else
+        s->partial_slabs[cls] = slab->next;
+    if (slab->next)
+        slab->next->prev = slab->prev;
+    slab->listed = false;
+}
+
+/* Size class serving a block of total_size bytes, 0 if too large */
+static size_t slab_class_of(size_t total_size)
+{
+    if (!slab_pool || total_size > SLAB_MAX_BLOCK)
+        return 0;
+    return (total_size + SLAB_GRAIN - 1) / SLAB_GRAIN;
+}
+
+static block_element_t *slab_alloc(shard_t *s, size_t cls)
+{
+    slab_t *slab = s->partial_slabs[cls];
+    if (!slab) {
+        slab = s->spare_slabs[cls];
+        s->spare_slabs[cls] = NULL;
+        if (!slab) {
+            slab = aligned_alloc(SLAB_SIZE, SLAB_SIZE);
+            if (!slab)
+                return NULL;
+            slab->free_slots = NULL;
+            slab->bump = SLAB_FIRST_SLOT;
+            slab->in_use = 0;
+            slab->slot_size = cls * SLAB_GRAIN;
+        }
+        slab_link(s, slab, cls);
+    }
+
+    void *slot = slab->free_slots;
+    if (slot) {
+        slab->free_slots = *(void **) slot;
+    } else {
+        slot = (unsigned char *) slab + slab->bump;
+        slab->bump += slab->slot_size;
+    }
+    slab->in_use++;
+
+    if (!slab->free_slots && slab->bump + slab->slot_size > SLAB_SIZE)
+        slab_unlink(s, slab, cls);
+
+    return slot;
+}
+
+/* Return block b to its slab, which belongs to shard s as b does */
+static void slab_free(shard_t *s, block_element_t *b)
+{
+    size_t cls = b->slab_class;
+    slab_t *slab = (slab_t *) ((uintptr_t) b & ~(uintptr_t) (SLAB_SIZE - 1));
+
+    *(void **) b = slab->free_slots;
+    slab->free_slots = b;
+    slab->in_use--;
+
+    if (!slab->listed)
+        slab_link(s, slab, cls);
+
+    /* Hand empty slabs back to malloc, but keep one around so that a queue
+     * oscillating around a slab boundary does not thrash.
+     */
+    if (!slab->in_use) {
+        slab_unlink(s, slab, cls);
+        if (s->spare_slabs[cls]) {
+            free(slab);
+        } else {
+            slab->free_slots = NULL;
+            slab->bump = SLAB_FIRST_SLOT;
+            s->spare_slabs[cls] = slab;
+        }
+    }
+}
+
+/* Profile of the call site whose return address is caller.  Threads share
+ * the table, so entries are claimed and counted with atomic operations.
+ */
+static alloc_site_t *site_of(const void *caller)
+{
+    size_t i = (size_t) (((uintptr_t) caller * UINT64_C(0x9e3779b97f4a7c15)) >>
+                         (64 - SITE_BITS));
+    for (;;) {
+        const void *c = __atomic_load_n(&sites[i].caller, __ATOMIC_ACQUIRE);
+        if (c == caller)
+            return &sites[i];
+        if (c) {
+            i = (i + 1) & (SITE_SLOTS - 1);
+            continue;
+        }
+        if (2 * (__atomic_load_n(&site_count, __ATOMIC_RELAXED) + 1) >
+            SITE_SLOTS)
+            return &site_overflow;
+        /* On failure, c is what another thread put there; look again */
+        if (__atomic_compare_exchange_n(&sites[i].caller, &c, caller, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            __atomic_fetch_add(&site_count, 1, __ATOMIC_RELAXED);
+            return &sites[i];
+        }
+    }
+}
+
+static void *alloc(alloc_t alloc_type, size_t size, const void *caller)
 {
     if (noallocate_mode) {
         char *msg_alloc_forbidden[] = {
@@ -135,39 +559,81 @@ static void *alloc(alloc_t alloc_type, size_t size)
         return NULL;
     }
 
-    if (fail_allocation()) {
+    /* random() and the report take locks of libc, so are not jumped out of */
+    exceptions_hold();
+    bool fail = fail_allocation();
+    if (fail) {
         char *msg_alloc_failure[] = {
             "Malloc returning NULL",
             "Calloc returning NULL",
             "Realloc returning NULL",
         };
         report_event(MSG_WARN, "%s", msg_alloc_failure[alloc_type]);
-        return NULL;
     }
+    char *held = exceptions_release();
+    if (held)
+        trigger_exception(held);
+    if (fail)
+        return NULL;
 
-    block_element_t *new_block =
-        malloc(size + sizeof(block_element_t) + sizeof(size_t));
+    size_t total_size = size + sizeof(block_element_t) + sizeof(size_t);
+    size_t cls = slab_class_of(total_size);
+    shard_t *s = shard_self();
+    shard_lock(s);
+    block_element_t *new_block = NULL;
+    if (registry_reserve(s))
+        new_block = cls ? slab_alloc(s, cls) : malloc(total_size);
     if (!new_block) {
+        shard_unlock(s);
         report_event(MSG_FATAL, "Couldn't allocate any more memory");
-        error_occurred = true;
+        flag_error();
+        return NULL;
     }
 
     // cppcheck-suppress nullPointerRedundantCheck
     new_block->magic_header = MAGICHEADER;
     // cppcheck-suppress nullPointerRedundantCheck
     new_block->payload_size = size;
+    // cppcheck-suppress nullPointerRedundantCheck
+    new_block->slab_class = cls;
     *find_footer(new_block) = MAGICFOOTER;
+
+    /* Bytes taken per block: a whole slot, or what malloc really set aside */
+    alloc_stats_t *stats =
+        &s->size_stats[size ? 64 - __builtin_clzll(size) : 0];
+    stats->requests++;
+    stats->requested += size;
+    stats->overhead += total_size - size;
+#if defined(__linux__) || defined(__APPLE__)
+    stats->usable += cls ? cls * SLAB_GRAIN : malloc_usable_size(new_block);
+#else
+    stats->usable += cls ? cls * SLAB_GRAIN : total_size;
+#endif
+
+    alloc_site_t *site = site_of(caller);
+    __atomic_fetch_add(&site->allocs, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&site->live, 1, __ATOMIC_RELAXED);
+    size_t live_bytes =
+        __atomic_add_fetch(&site->live_bytes, size, __ATOMIC_RELAXED);
+    size_t peak = __atomic_load_n(&site->peak_bytes, __ATOMIC_RELAXED);
+    while (live_bytes > peak &&
+           !__atomic_compare_exchange_n(&site->peak_bytes, &peak, live_bytes,
+                                        true, __ATOMIC_RELAXED,
+                                        __ATOMIC_RELAXED))
+        ;
+    new_block->site = site;
+
+    s->registry[registry_find(s, new_block)] = new_block;
+    s->allocated_count++;
+    held = shard_release(s);
+
     void *p = (void *) &new_block->payload;
+    if (held) {
+        /* The exception jumps out before the caller gets the block */
+        test_free(p);
+        trigger_exception(held);
+    }
     memset(p, !alloc_type * FILLCHAR, size);
-    // cppcheck-suppress nullPointerRedundantCheck
-    new_block->next = allocated;
-    // cppcheck-suppress nullPointerRedundantCheck
-    new_block->prev = NULL;
-
-    if (allocated)
-        allocated->prev = new_block;
-    allocated = new_block;
-    allocated_count++;
 
     return p;
 }
@@ -176,7 +642,7 @@ static void *alloc(alloc_t alloc_type, size_t size)
 
 void *test_malloc(size_t size)
 {
-    return alloc(TEST_MALLOC, size);
+    return alloc(TEST_MALLOC, size, __builtin_return_address(0));
 }
 
 // cppcheck-suppress unusedFunction
@@ -187,7 +653,7 @@ void *test_calloc(size_t nelem, size_t elsize)
      */
     if (!nelem || !elsize || nelem > SIZE_MAX / elsize)
         return NULL;
-    return alloc(TEST_CALLOC, nelem * elsize);
+    return alloc(TEST_CALLOC, nelem * elsize, __builtin_return_address(0));
 }
 
 /*
@@ -196,17 +662,24 @@ void *test_calloc(size_t nelem, size_t elsize)
  */
 void *test_realloc(void *p, size_t new_size)
 {
+    const void *caller = __builtin_return_address(0);
     if (!p)
-        return alloc(TEST_REALLOC, new_size);
+        return alloc(TEST_REALLOC, new_size, caller);
 
-    const block_element_t *b = find_header(p);
-    if (b->payload_size >= new_size)
+    shard_t *s;
+    size_t slot;
+    const block_element_t *b = find_header(p, &s, &slot);
+    if (!b)
+        return NULL;
+    size_t old_size = b->payload_size;
+    shard_unlock(s);
+    if (old_size >= new_size)
         return p;
 
-    void *new_ptr = alloc(TEST_REALLOC, new_size);
+    void *new_ptr = alloc(TEST_REALLOC, new_size, caller);
     if (!new_ptr)
         return NULL;
-    memcpy(new_ptr, p, b->payload_size);
+    memcpy(new_ptr, p, old_size);
     test_free(p);
 
     return new_ptr;
@@ -222,38 +695,44 @@ void test_free(void *p)
     if (!p)
         return;
 
-    block_element_t *b = find_header(p);
-    size_t footer = *find_footer(b);
-    if (footer != MAGICFOOTER) {
-        report_event(MSG_ERROR,
-                     "Corruption detected in block with address %p when "
-                     "attempting to free it",
-                     p);
-        error_occurred = true;
-    }
+    shard_t *s;
+    size_t slot;
+    block_element_t *b = find_header(p, &s, &slot);
+    if (!b)
+        return;
     b->magic_header = MAGICFREE;
-    *find_footer(b) = MAGICFREE;
-    memset(p, FILLCHAR, b->payload_size);
-
-    /* Unlink from list */
-    block_element_t *bn = b->next;
-    block_element_t *bp = b->prev;
-    if (bp)
-        bp->next = bn;
-    else
-        allocated = bn;
-    if (bn)
-        bn->prev = bp;
+    if (cautious_rate <= 0 || ++s->free_count % cautious_rate == 0) {
+        bool fits = payload_fits(s, b);
+        if (!fits || *find_footer(b) != MAGICFOOTER) {
+            report_event(MSG_ERROR,
+                         "Corruption detected in block with address %p when "
+                         "attempting to free it",
+                         p);
+            flag_error();
+        }
+        if (fits) {
+            *find_footer(b) = MAGICFREE;
+            memset(p, FILLCHAR, b->payload_size);
+        }
+    }
+
+    __atomic_fetch_sub(&b->site->live, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_sub(&b->site->live_bytes, b->payload_size,
+                       __ATOMIC_RELAXED);
 
-    free(b);
-    allocated_count--;
+    registry_remove(s, slot);
+    if (b->slab_class)
+        slab_free(s, b);
+    else
+        free(b);
+    shard_unlock(s);
 }
 
 // cppcheck-suppress unusedFunction
 char *test_strdup(const char *s)
 {
     size_t len = strlen(s) + 1;
-    void *new = test_malloc(len);
+    void *new = alloc(TEST_MALLOC, len, __builtin_return_address(0));
     if (!new)
         return NULL;
 
@@ -262,19 +741,149 @@ char *test_strdup(const char *s)
 
 size_t allocation_check()
 {
-    return allocated_count;
+    size_t count = 0;
+    for (unsigned i = 0; i < shards_used(); i++) {
+        shard_lock(&shards[i]);
+        count += shards[i].allocated_count;
+        shard_unlock(&shards[i]);
+    }
+    return count;
 }
 
-/* Implementation of functions for testing */
+/* Name the code at caller as symbol+offset, or as module+offset for
+ * addr2line when it has no exported symbol
+ */
+static void site_name(const void *caller, char *buf, size_t size)
+{
+#ifdef HAVE_DLADDR
+    Dl_info info;
+    if (dladdr(caller, &info) && info.dli_sname) {
+        snprintf(buf, size, "%s+%#tx", info.dli_sname,
+                 (const char *) caller - (const char *) info.dli_saddr);
+        return;
+    }
+    if (dladdr(caller, &info) && info.dli_fname) {
+        const char *module = strrchr(info.dli_fname, '/');
+        snprintf(buf, size, "%s+%#tx", module ? module + 1 : info.dli_fname,
+                 (const char *) caller - (const char *) info.dli_fbase);
+        return;
+    }
+#endif
+    snprintf(buf, size, "%p", caller);
+}
+
+static int cmp_site(const void *a, const void *b)
+{
+    const alloc_site_t *sa = *(const alloc_site_t **) a;
+    const alloc_site_t *sb = *(const alloc_site_t **) b;
+    if (sa->live_bytes != sb->live_bytes)
+        return sa->live_bytes < sb->live_bytes ? 1 : -1;
+    if (sa->peak_bytes != sb->peak_bytes)
+        return sa->peak_bytes < sb->peak_bytes ? 1 : -1;
+    return 0;
+}
+
+void allocation_profile(int vlevel, bool live_only)
+{
+    alloc_site_t *list[SITE_SLOTS + 1];
+    size_t n = 0;
+    for (size_t i = 0; i < SITE_SLOTS; i++) {
+        if (sites[i].caller && (sites[i].live || !live_only))
+            list[n++] = &sites[i];
+    }
+    if (site_overflow.live || (site_overflow.allocs && !live_only))
+        list[n++] = &site_overflow;
+    qsort(list, n, sizeof(*list), cmp_site);
+
+    report(vlevel, "%-40s %10s %10s %12s %12s", "Call site", "Allocs", "Live",
+           "Live bytes", "Peak bytes");
+    for (size_t i = 0; i < n; i++) {
+        char name[256] = "(other sites)";
+        if (list[i] != &site_overflow)
+            site_name(list[i]->caller, name, sizeof(name));
+        report(vlevel, "%-40s %10zu %10zu %12zu %12zu", name, list[i]->allocs,
+               list[i]->live, list[i]->live_bytes, list[i]->peak_bytes);
+    }
+}
+
+static void stats_add(alloc_stats_t *sum, const alloc_stats_t *st)
+{
+    sum->requests += st->requests;
+    sum->requested += st->requested;
+    sum->overhead += st->overhead;
+    sum->usable += st->usable;
+}
+
+void allocation_stats(alloc_stats_t *total, alloc_stats_t *buckets)
+{
+    memset(total, 0, sizeof(*total));
+    if (buckets)
+        memset(buckets, 0, ALLOC_BUCKETS * sizeof(*buckets));
+    for (unsigned k = 0; k < shards_used(); k++) {
+        shard_t *s = &shards[k];
+        shard_lock(s);
+        for (int i = 0; i < ALLOC_BUCKETS; i++) {
+            stats_add(total, &s->size_stats[i]);
+            if (buckets)
+                stats_add(&buckets[i], &s->size_stats[i]);
+        }
+        shard_unlock(s);
+    }
+}
 
-/* Set/unset cautious mode.
- * In this mode, makes extra sure any block to be freed is currently allocated.
+/* State of the generator picking the registry slots to sweep, kept apart
+ * from random() so that sweeping leaves the allocations fail_allocation()
+ * picks unchanged.  Only the thread running qtest commands sweeps.
  */
-void set_cautious_mode(bool cautious)
+static uintptr_t sweep_state;
+
+/* Check the blocks in a random 1 / cautious_rate of the registry slots of
+ * shard s, which must be locked.  Each slot is drawn independently, so
+ * blocks next to each other in the table are not checked together.
+ */
+static bool shard_sweep(shard_t *s)
 {
-    cautious_mode = cautious;
+    if (!s->registry)
+        return true;
+
+    size_t slots = (size_t) 1 << s->registry_bits;
+    bool ok = true;
+    for (size_t todo = (slots + cautious_rate - 1) / cautious_rate; todo;
+         todo--) {
+        sweep_state += (uintptr_t) UINT64_C(0x9e3779b97f4a7c15);
+        const block_element_t *b =
+            s->registry[random_shuffle(sweep_state) & (slots - 1)];
+        if (!b)
+            continue;
+        /* A wild payload size would send find_footer() out of the block */
+        if (b->magic_header != MAGICHEADER || !payload_fits(s, b) ||
+            *find_footer((block_element_t *) b) != MAGICFOOTER) {
+            report_event(MSG_ERROR,
+                         "Corruption detected in allocated block with "
+                         "address %p",
+                         (void *) b->payload);
+            ok = false;
+        }
+    }
+    return ok;
 }
 
+bool allocation_sweep()
+{
+    if (cautious_rate <= 0)
+        return true;
+
+    bool ok = true;
+    for (unsigned i = 0; i < shards_used(); i++) {
+        shard_lock(&shards[i]);
+        ok = shard_sweep(&shards[i]) && ok;
+        shard_unlock(&shards[i]);
+    }
+    return ok;
+}
+
+/* Implementation of functions for testing */
+
 /* Set/unset restricted allocation mode.
  * In this mode, calls to malloc and free are disallowed.
  */
@@ -286,9 +895,7 @@ void set_noallocate_mode(bool noallocate)
 /* Return whether any errors have occurred since last time set error limit */
 bool error_check()
 {
-    bool e = error_occurred;
-    error_occurred = false;
-    return e;
+    return __atomic_exchange_n(&error_occurred, false, __ATOMIC_RELAXED);
 }
 
 /* Prepare for a risky operation using setjmp.
@@ -301,6 +908,7 @@ bool exception_setup(bool limit_time)
         jmp_ready = false;
         if (time_limited) {
             alarm(0);
+            alarm_set = false;
             time_limited = false;
         }
 
@@ -313,6 +921,8 @@ bool exception_setup(bool limit_time)
     /* Got here from initial call */
     jmp_ready = true;
     if (limit_time) {
+        alarm_thread = pthread_self();
+        alarm_set = true;
         alarm(time_limit);
         time_limited = true;
     }
@@ -324,6 +934,7 @@ void exception_cancel()
 {
     if (time_limited) {
         alarm(0);
+        alarm_set = false;
         time_limited = false;
     }
 
@@ -334,8 +945,22 @@ void exception_cancel()
 /* Use longjmp to return to most recent exception setup */
 void trigger_exception(char *msg)
 {
-    error_occurred = true;
+    /* A time limit set by another thread, hand the signal over to it */
+    if (!jmp_ready && alarm_set &&
+        !pthread_equal(pthread_self(), alarm_thread)) {
+        pthread_kill(alarm_thread, SIGALRM);
+        return;
+    }
+
+    if (locks_held) {
+        deferred_message = msg;
+        return;
+    }
+
+    flag_error();
     error_message = msg;
+    /* Jumping out, an exception held back until now is superseded */
+    deferred_message = NULL;
     if (jmp_ready)
         siglongjmp(env, 1);
     else
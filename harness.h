@@ -18,17 +18,48 @@ char *test_strdup(const char *s);
 
 #ifdef INTERNAL
 
-/* Report number of allocated blocks */
+/* Report number of allocated blocks, summed over all threads */
 size_t allocation_check();
 
+/* Report the blocks allocated from each call site of test_malloc() and
+ * friends at verbosity vlevel, only the sites having some still allocated
+ * with live_only.  Largest live bytes first.
+ */
+void allocation_profile(int vlevel, bool live_only);
+
+/* Requests of size 0 fall in bucket 0, those of [2^(k-1), 2^k) in bucket k */
+#define ALLOC_BUCKETS 65
+
+/* Statistics of allocation requests served */
+typedef struct {
+    size_t requests;
+    size_t requested; /* Bytes asked for */
+    size_t overhead;  /* Bytes of the headers and footers added */
+    size_t usable;    /* Bytes taken from slabs or malloc, all included */
+} alloc_stats_t;
+
+/* Store the statistics of all requests served so far in total, and those
+ * of each bucket of sizes in buckets unless it is NULL
+ */
+void allocation_stats(alloc_stats_t *total, alloc_stats_t *buckets);
+
+/* Only check the footer of every Nth block freed, 0 for every block */
+extern int cautious_rate;
+
+/* Check the header and footer of about 1 / cautious_rate of the allocated
+ * blocks, picked at random, none if cautious_rate is 0.  Return false if
+ * any is corrupted.
+ */
+bool allocation_sweep();
+
 /* Probability of malloc failing, expressed as percent */
 extern int fail_probability;
 
-/*
- * Set/unset cautious mode.
- * In this mode, makes extra sure any block to be freed is currently allocated.
- */
-void set_cautious_mode(bool cautious);
+/* Whether small blocks are carved out of slabs rather than malloc'd */
+extern int slab_pool;
+
+/* Seconds a queue operation may run, 0 for no limit */
+extern int time_limit;
 
 /*
  * Set/unset restricted allocation mode.
@@ -36,10 +67,12 @@ void set_cautious_mode(bool cautious);
  */
 void set_noallocate_mode(bool noallocate);
 
-/* Return whether any errors have occurred since last time checked */
+/* Return whether any errors have occurred since last time checked, in any
+ * thread
+ */
 bool error_check();
 
-/* Prepare for a risky operation using setjmp.
+/* Prepare for a risky operation using setjmp, in the calling thread.
  * Function returns true for initial return, false for error return
  */
 bool exception_setup(bool limit_time);
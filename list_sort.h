@@ -20,4 +20,17 @@ void merge_final(list_cmp_func_t cmp,
                  struct list_head *a,
                  struct list_head *b);
 
+/* Branchless counterparts of merge() and merge_final() */
+struct list_head *merge_branchless(list_cmp_func_t cmp,
+                                   struct list_head *a,
+                                   struct list_head *b);
+
+void merge_final_branchless(list_cmp_func_t cmp,
+                            struct list_head *head,
+                            struct list_head *a,
+                            struct list_head *b);
+
+/* Whether list_sort() merges with the branchless variants */
+extern int list_sort_branchless;
+
 void list_sort(struct list_head *head, list_cmp_func_t cmp, bool descend);
@@ -19,13 +19,18 @@
 #include <time.h>
 #endif
 
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include "dudect/cpucycles.h"
 #include "dudect/fixture.h"
 #include "list.h"
 #include "random.h"
 
 
-extern void q_shuffle(struct list_head *head);
-
 /* Shannon entropy */
 extern double shannon_entropy(const uint8_t *input_data);
 extern int show_entropy;
@@ -46,6 +51,7 @@ extern int show_entropy;
  * solution code
  */
 #include "queue.h"
+#include "queue_ext.h"
 
 #include "console.h"
 #include "list_sort.h"
@@ -57,7 +63,6 @@ extern int show_entropy;
 
 /* How large is a queue before it's considered big.
  * This affects how it gets printed
- * and whether cautious mode is used when freeing the queue
  */
 #define BIG_LIST_SIZE 30
 
@@ -71,6 +76,67 @@ typedef struct {
 static queue_chain_t chain = {.size = 0};
 static queue_contex_t *current = NULL;
 
+/* Context of a queue in qtest.  A queue made by `new ring` keeps its
+ * strings in ring, and one made by `new chunked` in chunked; either way its
+ * list q stays empty.  Both are NULL for the other queues.
+ */
+typedef struct {
+    queue_contex_t ctx;
+    ring_t *ring;
+    chunked_t *chunked;
+} qtest_contex_t;
+
+#define ring_of(c) (container_of(c, qtest_contex_t, ctx)->ring)
+#define chunked_of(c) (container_of(c, qtest_contex_t, ctx)->chunked)
+
+/* Reject the command cmd if the current queue is a ring buffer, which only
+ * supports inserting, removing, size, reverse, swap, sort and show.
+ */
+static bool ring_rejects(const char *cmd)
+{
+    if (!current || !ring_of(current))
+        return false;
+    report(1, "ERROR: %s is not supported on ring queues", cmd);
+    return true;
+}
+
+/* Reject the command cmd if the current queue is a chunked queue, which
+ * only supports inserting, removing, size, reverse, sort, dedup, merge and
+ * show.
+ */
+static bool chunked_rejects(const char *cmd)
+{
+    if (!current || !chunked_of(current))
+        return false;
+    report(1, "ERROR: %s is not supported on chunked queues", cmd);
+    return true;
+}
+
+/* Number of strings in the ring buffer or chunked queue of ctx */
+static int variant_size(queue_contex_t *ctx)
+{
+    return ring_of(ctx) ? q_ring_size(ring_of(ctx))
+                        : q_chunked_size(chunked_of(ctx));
+}
+
+/* String at position i of the ring buffer or chunked queue of ctx */
+static const char *variant_at(queue_contex_t *ctx, int i)
+{
+    return ring_of(ctx) ? q_ring_at(ring_of(ctx), i)
+                        : q_chunked_at(chunked_of(ctx), i);
+}
+
+/* Reject the simulation of command cmd on a chunked queue, for which dudect
+ * has no measurements
+ */
+static bool simulation_rejects(const char *cmd)
+{
+    if (!current || !chunked_of(current))
+        return false;
+    report(1, "ERROR: %s cannot be simulated on chunked queues", cmd);
+    return true;
+}
+
 /* How many times can queue operations fail */
 static int fail_limit = BIG_LIST_SIZE;
 static int fail_count = 0;
@@ -79,6 +145,13 @@ static int string_length = MAXSTRING;
 
 static int descend = 0;
 
+/* Whether listsort compares cached key prefixes, see list_sort_keyed() */
+static int key_cache = 0;
+
+/* Whether to report the fragmentation of each command's allocations */
+static int frag_report = 0;
+static alloc_stats_t frag_last;
+
 #define MIN_RANDSTR_LEN 5
 #define MAX_RANDSTR_LEN 10
 static const char charset[] = "abcdefghijklmnopqrstuvwxyz";
@@ -87,6 +160,13 @@ typedef enum {
     POS_TAIL,
     POS_HEAD,
 } position_t;
+/* For queue_sort */
+typedef enum {
+    SORT_QUEUE,
+    SORT_LIST,
+    SORT_ARRAY,
+    SORT_RADIX,
+} sort_method_t;
 /* Forward declarations */
 static bool q_show(int vlevel);
 
@@ -105,9 +185,6 @@ static bool do_free(int argc, char *argv[])
     }
     error_check();
 
-    if (current && current->size > BIG_LIST_SIZE)
-        set_cautious_mode(false);
-
     struct list_head *qnext = NULL;
     if (chain.size > 1) {
         qnext = (current->chain.next == &chain.head) ? chain.head.next
@@ -117,10 +194,12 @@ static bool do_free(int argc, char *argv[])
     if (current) {
         list_del(&current->chain);
 
-        if (exception_setup(true))
+        if (exception_setup(true)) {
             q_free(current->q);
+            q_ring_free(ring_of(current));
+            q_chunked_free(chunked_of(current));
+        }
         exception_cancel();
-        set_cautious_mode(true);
     }
 
     if (current) {
@@ -144,22 +223,34 @@ static bool do_free(int argc, char *argv[])
 
 static bool do_new(int argc, char *argv[])
 {
-    if (argc != 1) {
-        report(1, "%s takes no arguments", argv[0]);
+    bool ring = argc == 2 && !strcmp(argv[1], "ring");
+    bool chunked = argc == 2 && !strcmp(argv[1], "chunked");
+    if (argc != 1 && !ring && !chunked) {
+        report(1, "%s takes no arguments but ring or chunked", argv[0]);
         return false;
     }
 
     bool ok = true;
 
     if (exception_setup(true)) {
-        queue_contex_t *qctx = malloc(sizeof(queue_contex_t));
-        list_add_tail(&qctx->chain, &chain.head);
-
-        qctx->size = 0;
-        qctx->q = q_new();
-        qctx->id = chain.size++;
+        qtest_contex_t *qctx = malloc(sizeof(qtest_contex_t));
+        list_add_tail(&qctx->ctx.chain, &chain.head);
+
+        qctx->ctx.size = 0;
+        qctx->ctx.q = q_new();
+        qctx->ctx.id = chain.size++;
+        qctx->ring = ring ? q_ring_new() : NULL;
+        if (ring && !qctx->ring) {
+            report(1, "ERROR: Could not allocate ring buffer");
+            ok = false;
+        }
+        qctx->chunked = chunked ? q_chunked_new() : NULL;
+        if (chunked && !qctx->chunked) {
+            report(1, "ERROR: Could not allocate chunked queue");
+            ok = false;
+        }
 
-        current = qctx;
+        current = &qctx->ctx;
     }
     exception_cancel();
     q_show(3);
@@ -184,6 +275,90 @@ static void fill_rand_string(char *buf, size_t buf_size)
     buf[len] = '\0';
 }
 
+/* Insert reps copies of inserts (or random strings) in a single batch */
+static bool queue_insert_bulk(position_t pos,
+                              char *inserts,
+                              bool need_rand,
+                              int reps)
+{
+    char **strs = malloc(sizeof(char *) * reps);
+    char *randstrs = need_rand ? malloc((size_t) reps * MAX_RANDSTR_LEN) : NULL;
+    if (!strs || (need_rand && !randstrs)) {
+        report(1,
+               "INTERNAL ERROR.  Could not allocate space for inserted "
+               "strings");
+        free(strs);
+        free(randstrs);
+        return false;
+    }
+
+    for (int r = 0; r < reps; r++) {
+        strs[r] = inserts;
+        if (need_rand) {
+            strs[r] = randstrs + (size_t) r * MAX_RANDSTR_LEN;
+            fill_rand_string(strs[r], MAX_RANDSTR_LEN);
+        }
+    }
+
+    if (exception_setup(true)) {
+        if (pos == POS_TAIL)
+            q_insert_tail_bulk(current->q, strs, reps);
+        else
+            q_insert_head_bulk(current->q, strs, reps);
+    }
+    exception_cancel();
+    /* Elements join the queue one by one, so even a batch cut short by the
+     * time limit inserted exactly those the queue grew by
+     */
+    int cnt = q_size(current->q) - current->size;
+    current->size += cnt;
+    bool ok = !error_check();
+
+    if (ok && cnt < reps) {
+        fail_count += reps - cnt;
+        if (fail_count < fail_limit)
+            report(2, "Insertion of %d elements failed", reps - cnt);
+        else {
+            report(1,
+                   "ERROR: Insertion of %d elements failed (%d failures "
+                   "total)",
+                   reps - cnt, fail_count);
+            ok = false;
+        }
+    }
+
+    /* The new elements are the first or the last cnt ones in the queue */
+    char *lasts = NULL;
+    q_materialize(current->q);
+    struct list_head *cur =
+        pos == POS_TAIL ? current->q->prev : current->q->next;
+    for (int r = 0; ok && r < cnt; r++) {
+        char *cur_inserts = list_entry(cur, element_t, list)->value;
+        if (!cur_inserts) {
+            report(1, "ERROR: Failed to save copy of string in queue");
+            ok = false;
+        } else if (cur_inserts == inserts ||
+                   (randstrs && cur_inserts >= randstrs &&
+                    cur_inserts < randstrs + (size_t) reps * MAX_RANDSTR_LEN)) {
+            report(1,
+                   "ERROR: Need to allocate and copy string for new queue "
+                   "element");
+            ok = false;
+        } else if (lasts == cur_inserts) {
+            report(1,
+                   "ERROR: Need to allocate separate string for each queue "
+                   "element");
+            ok = false;
+        }
+        lasts = cur_inserts;
+        cur = pos == POS_TAIL ? cur->prev : cur->next;
+    }
+
+    free(strs);
+    free(randstrs);
+    return ok && !error_check();
+}
+
 /* insertion */
 static bool queue_insert(position_t pos, int argc, char *argv[])
 {
@@ -192,8 +367,15 @@ static bool queue_insert(position_t pos, int argc, char *argv[])
             report(1, "%s does not need arguments in simulation mode", argv[0]);
             return false;
         }
-        bool ok =
-            pos == POS_TAIL ? is_insert_tail_const() : is_insert_head_const();
+        if (simulation_rejects(argv[0]))
+            return false;
+        bool ok;
+        if (current && ring_of(current))
+            ok = pos == POS_TAIL ? is_ring_insert_tail_const()
+                                 : is_ring_insert_head_const();
+        else
+            ok = pos == POS_TAIL ? is_insert_tail_const()
+                                 : is_insert_head_const();
         if (!ok) {
             report(1,
                    "ERROR: Probably not constant time or wrong implementation");
@@ -203,7 +385,7 @@ static bool queue_insert(position_t pos, int argc, char *argv[])
         return ok;
     }
 
-    char *lasts = NULL;
+    const char *lasts = NULL;
     char randstr_buf[MAX_RANDSTR_LEN];
     int reps = 1;
     bool ok = true, need_rand = false;
@@ -230,19 +412,43 @@ static bool queue_insert(position_t pos, int argc, char *argv[])
                pos == POS_TAIL ? "tail" : "head");
     error_check();
 
+    ring_t *ring = current ? ring_of(current) : NULL;
+    chunked_t *chunked = current ? chunked_of(current) : NULL;
+    if (current && current->q && !ring && !chunked && reps > 1) {
+        ok = queue_insert_bulk(pos, inserts, need_rand, reps);
+        q_show(3);
+        return ok;
+    }
+
     if (current && exception_setup(true)) {
         for (int r = 0; ok && r < reps; r++) {
             if (need_rand)
                 fill_rand_string(randstr_buf, sizeof(randstr_buf));
-            bool rval = pos == POS_TAIL ? q_insert_tail(current->q, inserts)
-                                        : q_insert_head(current->q, inserts);
+            bool rval;
+            if (ring)
+                rval = pos == POS_TAIL ? q_ring_insert_tail(ring, inserts)
+                                       : q_ring_insert_head(ring, inserts);
+            else if (chunked)
+                rval = pos == POS_TAIL
+                           ? q_chunked_insert_tail(chunked, inserts)
+                           : q_chunked_insert_head(chunked, inserts);
+            else
+                rval = pos == POS_TAIL ? q_insert_tail(current->q, inserts)
+                                       : q_insert_head(current->q, inserts);
             if (rval) {
                 current->size++;
-                element_t *entry =
-                    pos == POS_TAIL
-                        ? list_last_entry(current->q, element_t, list)
-                        : list_first_entry(current->q, element_t, list);
-                char *cur_inserts = entry->value;
+                const char *cur_inserts;
+                if (ring || chunked) {
+                    cur_inserts = variant_at(
+                        current, pos == POS_TAIL ? current->size - 1 : 0);
+                } else {
+                    q_materialize(current->q);
+                    element_t *entry =
+                        pos == POS_TAIL
+                            ? list_last_entry(current->q, element_t, list)
+                            : list_first_entry(current->q, element_t, list);
+                    cur_inserts = entry->value;
+                }
                 if (!cur_inserts) {
                     report(1, "ERROR: Failed to save copy of string in queue");
                     ok = false;
@@ -304,8 +510,15 @@ static bool queue_remove(position_t pos, int argc, char *argv[])
             report(1, "%s does not need arguments in simulation mode", argv[0]);
             return false;
         }
-        bool ok =
-            pos == POS_TAIL ? is_remove_tail_const() : is_remove_head_const();
+        if (simulation_rejects(argv[0]))
+            return false;
+        bool ok;
+        if (current && ring_of(current))
+            ok = pos == POS_TAIL ? is_ring_remove_tail_const()
+                                 : is_ring_remove_head_const();
+        else
+            ok = pos == POS_TAIL ? is_remove_tail_const()
+                                 : is_remove_head_const();
         if (!ok) {
             report(1,
                    "ERROR: Probably not constant time or wrong implementation");
@@ -353,18 +566,35 @@ static bool queue_remove(position_t pos, int argc, char *argv[])
     error_check();
 
     element_t *re = NULL;
-    if (current && exception_setup(true))
-        re = pos == POS_TAIL
-                 ? q_remove_tail(current->q, removes, string_length + 1)
-                 : q_remove_head(current->q, removes, string_length + 1);
+    bool removed = false;
+    ring_t *ring = current ? ring_of(current) : NULL;
+    chunked_t *chunked = current ? chunked_of(current) : NULL;
+    if (current && exception_setup(true)) {
+        if (ring)
+            removed =
+                pos == POS_TAIL
+                    ? q_ring_remove_tail(ring, removes, string_length + 1)
+                    : q_ring_remove_head(ring, removes, string_length + 1);
+        else if (chunked)
+            removed = pos == POS_TAIL
+                          ? q_chunked_remove_tail(chunked, removes,
+                                                  string_length + 1)
+                          : q_chunked_remove_head(chunked, removes,
+                                                  string_length + 1);
+        else
+            re = pos == POS_TAIL
+                     ? q_remove_tail(current->q, removes, string_length + 1)
+                     : q_remove_head(current->q, removes, string_length + 1);
+    }
     exception_cancel();
 
-    bool is_null = re ? false : true;
+    bool is_null = !re && !removed;
 
     if (!is_null) {
         // q_remove_head and q_remove_tail are not responsible for releasing
         // node
-        q_release_element(re);
+        if (re)
+            q_release_element(re);
 
         removes[string_length + STRINGPAD] = '\0';
         if (removes[0] == '\0') {
@@ -421,10 +651,164 @@ static inline bool do_rt(int argc, char *argv[])
     return queue_remove(POS_TAIL, argc, argv);
 }
 
+static int cmp_string(const void *a, const void *b)
+{
+    return strcmp(*(char *const *) a, *(char *const *) b);
+}
+
+/* Run q_delete_dup_hash() and check the queue against the reference built
+ * by sorting a copy of it and dropping every run of equal strings: each
+ * string of the original queue must remain, in its original order, exactly
+ * when it is alone in its run.
+ */
+static bool dedup_hash(void)
+{
+    int n = current->size;
+    char **orig = malloc(sizeof(char *) * (n ? n : 1));
+    char **sorted = malloc(sizeof(char *) * (n ? n : 1));
+    int copied = 0;
+    element_t *item;
+
+    if (orig && sorted) {
+        q_materialize(current->q);
+        list_for_each_entry(item, current->q, list) {
+            if (copied == n || !(orig[copied] = strdup(item->value)))
+                break;
+            copied++;
+        }
+    }
+    if (!orig || !sorted || copied != n) {
+        while (copied)
+            free(orig[--copied]);
+        free(orig);
+        free(sorted);
+        report(1,
+               "INTERNAL ERROR.  Could not allocate space for duplicate "
+               "checking");
+        return false;
+    }
+    memcpy(sorted, orig, sizeof(char *) * n);
+    qsort(sorted, n, sizeof(char *), cmp_string);
+
+    bool ok = true;
+    if (exception_setup(true))
+        ok = q_delete_dup_hash(current->q);
+    exception_cancel();
+
+    if (!ok && !n) {
+        report(1, "ERROR: Calling delete duplicate on null queue");
+    } else if (!ok) {
+        /* Only allocating the hash set can fail, leaving the queue intact */
+        fail_count++;
+        if (fail_count < fail_limit) {
+            report(2, "Hash deduplication failed");
+            ok = true;
+        } else {
+            report(1, "ERROR: Hash deduplication failed (%d failures total)",
+                   fail_count);
+        }
+    } else {
+        struct list_head *l_tmp = current->q->next;
+        for (int i = 0; i < n; i++) {
+            char **key =
+                bsearch(&orig[i], sorted, n, sizeof(char *), cmp_string);
+            int k = key - sorted;
+            bool is_dup = (k > 0 && !strcmp(sorted[k - 1], orig[i])) ||
+                          (k + 1 < n && !strcmp(sorted[k + 1], orig[i]));
+            if (is_dup) {
+                current->size--;
+            } else if (l_tmp != current->q &&
+                       !strcmp(list_entry(l_tmp, element_t, list)->value,
+                               orig[i])) {
+                l_tmp = l_tmp->next;
+            } else {
+                ok = false;
+            }
+        }
+        ok = ok && l_tmp == current->q;
+        if (!ok)
+            report(1,
+                   "ERROR: Duplicate strings are in queue or distinct strings "
+                   "are not in queue");
+    }
+
+    for (int i = 0; i < n; i++)
+        free(orig[i]);
+    free(orig);
+    free(sorted);
+
+    q_show(3);
+    return ok && !error_check();
+}
+
+/* Run q_chunked_delete_dup() and check the queue against a copy of it, the
+ * same way as for the lists
+ */
+static bool dedup_chunked(void)
+{
+    int n = current->size;
+    char **orig = malloc(sizeof(char *) * (n ? n : 1));
+    int copied = 0;
+
+    if (orig) {
+        while (copied < n &&
+               (orig[copied] = strdup(variant_at(current, copied))))
+            copied++;
+    }
+    if (!orig || copied != n) {
+        while (copied)
+            free(orig[--copied]);
+        free(orig);
+        report(1,
+               "INTERNAL ERROR.  Could not allocate space for duplicate "
+               "checking");
+        return false;
+    }
+
+    bool ok = true;
+    if (exception_setup(true))
+        ok = q_chunked_delete_dup(chunked_of(current));
+    exception_cancel();
+
+    if (!ok) {
+        while (n)
+            free(orig[--n]);
+        free(orig);
+        report(1, "ERROR: Calling delete duplicate on null queue");
+        return false;
+    }
+
+    int kept = 0;
+    for (int i = 0; i < n; i++) {
+        bool is_dup = (i > 0 && !strcmp(orig[i - 1], orig[i])) ||
+                      (i + 1 < n && !strcmp(orig[i + 1], orig[i]));
+        if (is_dup) {
+            current->size--;
+        } else {
+            const char *value = variant_at(current, kept++);
+            ok = ok && value && !strcmp(value, orig[i]);
+        }
+    }
+    ok = ok && kept == variant_size(current);
+    if (!ok)
+        report(1,
+               "ERROR: Duplicate strings are in queue or distinct strings are "
+               "not in queue");
+
+    for (int i = 0; i < n; i++)
+        free(orig[i]);
+    free(orig);
+
+    q_show(3);
+    return ok && !error_check();
+}
+
 static bool do_dedup(int argc, char *argv[])
 {
-    if (argc != 1) {
-        report(1, "%s takes no arguments", argv[0]);
+    if (ring_rejects(argv[0]))
+        return false;
+    if (argc > 2 || (argc == 2 && strcmp(argv[1], "hash"))) {
+        report(1, "%s takes no arguments or 'hash'", argv[0]);
         return false;
     }
 
@@ -433,11 +817,19 @@ static bool do_dedup(int argc, char *argv[])
         return false;
     }
 
+    if (argc == 2 && chunked_rejects("dedup hash"))
+        return false;
+    if (argc == 2)
+        return dedup_hash();
+    if (chunked_of(current))
+        return dedup_chunked();
+
     LIST_HEAD(l_copy);
     element_t *item = NULL, *tmp = NULL;
 
     // Copy current->q to l_copy
     if (current->q && !list_empty(current->q)) {
+        q_materialize(current->q);
         list_for_each_entry(item, current->q, list) {
             size_t slen;
             tmp = malloc(sizeof(element_t));
@@ -528,8 +920,14 @@ static bool do_reverse(int argc, char *argv[])
     error_check();
 
     set_noallocate_mode(true);
-    if (current && exception_setup(true))
-        q_reverse(current->q);
+    if (current && exception_setup(true)) {
+        if (ring_of(current))
+            q_ring_reverse(ring_of(current));
+        else if (chunked_of(current))
+            q_chunked_reverse(chunked_of(current));
+        else
+            q_reverse(current->q);
+    }
     exception_cancel();
 
     set_noallocate_mode(false);
@@ -539,6 +937,24 @@ static bool do_reverse(int argc, char *argv[])
 
 static bool do_size(int argc, char *argv[])
 {
+    if (simulation) {
+        if (argc != 1) {
+            report(1, "%s does not need arguments in simulation mode", argv[0]);
+            return false;
+        }
+        if (simulation_rejects(argv[0]))
+            return false;
+        bool ok = current && ring_of(current) ? is_ring_size_const()
+                                              : is_size_const();
+        if (!ok) {
+            report(1,
+                   "ERROR: Probably not constant time or wrong implementation");
+            return false;
+        }
+        report(1, "Probably constant time");
+        return ok;
+    }
+
     if (argc != 1 && argc != 2) {
         report(1, "%s takes 0-1 arguments", argv[0]);
         return false;
@@ -557,8 +973,9 @@ static bool do_size(int argc, char *argv[])
     error_check();
 
     if (current && exception_setup(true)) {
+        bool variant = ring_of(current) || chunked_of(current);
         for (int r = 0; ok && r < reps; r++) {
-            cnt = q_size(current->q);
+            cnt = variant ? variant_size(current) : q_size(current->q);
             ok = ok && !error_check();
         }
     }
@@ -580,89 +997,126 @@ static bool do_size(int argc, char *argv[])
     return ok && !error_check();
 }
 
-bool do_sort(int argc, char *argv[])
+/* Start counting the branch misses of this thread and of the threads it
+ * creates, in user space.  Returns the counter, or -1 where perf events are
+ * not available, as outside Linux or on machines without hardware counters.
+ */
+static int branch_misses_start(void)
 {
-    if (argc != 1) {
-        report(1, "%s takes no arguments", argv[0]);
-        return false;
-    }
+#if defined(__linux__) && defined(SYS_perf_event_open)
+    struct perf_event_attr attr = {
+        .type = PERF_TYPE_HARDWARE,
+        .size = sizeof(attr),
+        .config = PERF_COUNT_HW_BRANCH_MISSES,
+        .disabled = 1,
+        .inherit = 1,
+        .exclude_kernel = 1,
+        .exclude_hv = 1,
+    };
+    int fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (fd >= 0)
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    return fd;
+#else
+    return -1;
+#endif
+}
 
-    int cnt = 0;
-    if (!current || !current->q)
-        report(3, "Warning: Calling sort on null queue");
-    else
-        cnt = q_size(current->q);
-    error_check();
+/* Stop and close the counter from branch_misses_start(), returning its
+ * count or -1 if there is none
+ */
+static long long branch_misses_stop(int fd)
+{
+    long long count = -1;
+
+#if defined(__linux__) && defined(SYS_perf_event_open)
+    if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &count, sizeof(count)) != sizeof(count))
+            count = -1;
+        close(fd);
+    }
+#endif
+    return count;
+}
 
+/* Sort the ring buffer or chunked queue of the current queue with
+ * q_ring_sort() or q_chunked_sort() and check the result.  As with the
+ * lists, stability is checked by where each string was before.
+ */
+static bool queue_sort_variant(void)
+{
+    ring_t *ring = ring_of(current);
+    chunked_t *chunked = chunked_of(current);
+    int cnt = variant_size(current);
     if (cnt < 2)
         report(3, "Warning: Calling sort on single node");
     error_check();
 
-    set_noallocate_mode(true);
+    size_t scratch_size =
+        ring ? q_ring_sort_scratch(cnt) : q_chunked_sort_scratch(cnt);
+    void *scratch = malloc(scratch_size);
+    if (!scratch) {
+        report(1,
+               "INTERNAL ERROR.  Could not allocate scratch area for sorting");
+        return false;
+    }
 
-/* If the number of elements is too large, it may take a long time to check the
- * stability of the sort. So, MAX_NODES is used to limit the number of elements
- * to check the stability of the sort. */
 #define MAX_NODES 100000
-    struct list_head *nodes[MAX_NODES];
+    const char *strs[MAX_NODES];
     unsigned no = 0;
-    if (current && current->size && current->size <= MAX_NODES) {
-        element_t *entry;
-        list_for_each_entry(entry, current->q, list)
-            nodes[no++] = &entry->list;
-    } else if (current && current->size > MAX_NODES)
+    if (cnt <= MAX_NODES) {
+        for (int i = 0; i < cnt; i++)
+            strs[no++] = variant_at(current, i);
+    } else
         report(1,
                "Warning: Skip checking the stability of the sort because the "
                "number of elements %d is too large, exceeds the limit %d.",
-               current->size, MAX_NODES);
+               cnt, MAX_NODES);
 
-    if (current && exception_setup(true))
-        q_sort(current->q, descend);
+    set_noallocate_mode(true);
+    int64_t cycles = cpucycles();
+    if (exception_setup(true)) {
+        if (ring)
+            q_ring_sort(ring, descend, scratch, scratch_size);
+        else
+            q_chunked_sort(chunked, descend, scratch, scratch_size);
+    }
     exception_cancel();
+    cycles = cpucycles() - cycles;
     set_noallocate_mode(false);
+    free(scratch);
+    report(2, "Sorting took %lld cycles", (long long) cycles);
 
     bool ok = true;
-    if (current && current->size) {
-        for (struct list_head *cur_l = current->q->next;
-             cur_l != current->q && --cnt; cur_l = cur_l->next) {
-            /* Ensure each element in ascending/descending order */
-            element_t *item, *next_item;
-            item = list_entry(cur_l, element_t, list);
-            next_item = list_entry(cur_l->next, element_t, list);
-            if (!descend && strcmp(item->value, next_item->value) > 0) {
-                report(1, "ERROR: Not sorted in ascending order");
-                ok = false;
-                break;
+    for (int i = 0; i + 1 < cnt; i++) {
+        const char *item = variant_at(current, i);
+        const char *next_item = variant_at(current, i + 1);
+        int c = strcmp(item, next_item);
+        if (descend ? c < 0 : c > 0) {
+            report(1, "ERROR: Not sorted in %s order",
+                   descend ? "descending" : "ascending");
+            ok = false;
+            break;
+        }
+        if (cnt <= MAX_NODES && !c) {
+            bool unstable = false;
+            for (unsigned j = 0; j < no; j++) {
+                if (strs[j] == next_item) {
+                    unstable = true;
+                    break;
+                }
+                if (strs[j] == item)
+                    break;
             }
-
-            if (descend && strcmp(item->value, next_item->value) < 0) {
-                report(1, "ERROR: Not sorted in descending order");
+            if (unstable) {
+                report(1,
+                       "ERROR: Not stable sort. The duplicate strings \"%s\" "
+                       "are not in the same order.",
+                       item);
                 ok = false;
                 break;
             }
-            /* Ensure the stability of the sort */
-            if (current->size <= MAX_NODES &&
-                !strcmp(item->value, next_item->value)) {
-                bool unstable = false;
-                for (unsigned i = 0; i < MAX_NODES; i++) {
-                    if (nodes[i] == cur_l->next) {
-                        unstable = true;
-                        break;
-                    }
-                    if (nodes[i] == cur_l) {
-                        break;
-                    }
-                }
-                if (unstable) {
-                    report(
-                        1,
-                        "ERROR: Not stable sort. The duplicate strings \"%s\" "
-                        "are not in the same order.",
-                        item->value);
-                    ok = false;
-                    break;
-                }
-            }
         }
     }
 #undef MAX_NODES
@@ -671,13 +1125,19 @@ bool do_sort(int argc, char *argv[])
     return ok && !error_check();
 }
 
-bool do_listsort(int argc, char *argv[])
+static bool queue_sort(sort_method_t method, int argc, char *argv[])
 {
     if (argc != 1) {
         report(1, "%s takes no arguments", argv[0]);
         return false;
     }
 
+    if (method != SORT_QUEUE &&
+        (ring_rejects(argv[0]) || chunked_rejects(argv[0])))
+        return false;
+    if (current && (ring_of(current) || chunked_of(current)))
+        return queue_sort_variant();
+
     int cnt = 0;
     if (!current || !current->q)
         report(3, "Warning: Calling sort on null queue");
@@ -689,6 +1149,25 @@ bool do_listsort(int argc, char *argv[])
         report(3, "Warning: Calling sort on single node");
     error_check();
 
+    /* Scratch area of q_sort_array() and list_sort_keyed(), allocated
+     * before the sort may not
+     */
+    void *scratch = NULL;
+    size_t scratch_size = 0;
+    if (method == SORT_ARRAY && current)
+        scratch_size = q_sort_array_scratch(current->size);
+    else if (method == SORT_LIST && key_cache && current)
+        scratch_size = list_sort_keyed_scratch(current->size);
+    if (scratch_size) {
+        scratch = malloc(scratch_size);
+        if (!scratch) {
+            report(1,
+                   "INTERNAL ERROR.  Could not allocate scratch area for "
+                   "sorting");
+            return false;
+        }
+    }
+
     set_noallocate_mode(true);
 
 /* If the number of elements is too large, it may take a long time to check the
@@ -699,6 +1178,7 @@ bool do_listsort(int argc, char *argv[])
     unsigned no = 0;
     if (current && current->size && current->size <= MAX_NODES) {
         element_t *entry;
+        q_materialize(current->q);
         list_for_each_entry(entry, current->q, list)
             nodes[no++] = &entry->list;
     } else if (current && current->size > MAX_NODES)
@@ -707,13 +1187,39 @@ bool do_listsort(int argc, char *argv[])
                "number of elements %d is too large, exceeds the limit %d.",
                current->size, MAX_NODES);
 
-    if (current && exception_setup(true))
-        list_sort(current->q, cmp, descend);
+    int misses_fd = verblevel >= 2 ? branch_misses_start() : -1;
+    int64_t cycles = cpucycles();
+    if (current && exception_setup(true)) {
+        switch (method) {
+        case SORT_QUEUE:
+            q_sort(current->q, descend);
+            break;
+        case SORT_LIST:
+            /* Without a scratch area, this is list_sort() on strcmp() */
+            list_sort_keyed(current->q, descend, scratch, scratch_size);
+            break;
+        case SORT_ARRAY:
+            q_sort_array(current->q, descend, scratch, scratch_size);
+            break;
+        case SORT_RADIX:
+            q_sort_radix(current->q, descend);
+            break;
+        }
+    }
     exception_cancel();
+    cycles = cpucycles() - cycles;
+    long long misses = branch_misses_stop(misses_fd);
     set_noallocate_mode(false);
+    free(scratch);
+    if (misses >= 0)
+        report(2, "Sorting took %lld cycles, %lld branch misses",
+               (long long) cycles, misses);
+    else
+        report(2, "Sorting took %lld cycles", (long long) cycles);
 
     bool ok = true;
     if (current && current->size) {
+        q_materialize(current->q);
         for (struct list_head *cur_l = current->q->next;
              cur_l != current->q && --cnt; cur_l = cur_l->next) {
             /* Ensure each element in ascending/descending order */
@@ -762,8 +1268,30 @@ bool do_listsort(int argc, char *argv[])
     return ok && !error_check();
 }
 
+bool do_sort(int argc, char *argv[])
+{
+    return queue_sort(SORT_QUEUE, argc, argv);
+}
+
+bool do_listsort(int argc, char *argv[])
+{
+    return queue_sort(SORT_LIST, argc, argv);
+}
+
+static bool do_arraysort(int argc, char *argv[])
+{
+    return queue_sort(SORT_ARRAY, argc, argv);
+}
+
+static bool do_radixsort(int argc, char *argv[])
+{
+    return queue_sort(SORT_RADIX, argc, argv);
+}
+
 static bool do_dm(int argc, char *argv[])
 {
+    if (ring_rejects(argv[0]) || chunked_rejects(argv[0]))
+        return false;
     if (argc != 1) {
         report(1, "%s takes no arguments", argv[0]);
         return false;
@@ -790,6 +1318,8 @@ static bool do_dm(int argc, char *argv[])
 
 static bool do_swap(int argc, char *argv[])
 {
+    if (chunked_rejects(argv[0]))
+        return false;
     if (argc != 1) {
         report(1, "%s takes no arguments", argv[0]);
         return false;
@@ -802,8 +1332,12 @@ static bool do_swap(int argc, char *argv[])
     error_check();
 
     set_noallocate_mode(true);
-    if (exception_setup(true))
-        q_swap(current->q);
+    if (exception_setup(true)) {
+        if (ring_of(current))
+            q_ring_swap(ring_of(current));
+        else
+            q_swap(current->q);
+    }
     exception_cancel();
 
     set_noallocate_mode(false);
@@ -815,6 +1349,8 @@ static bool do_swap(int argc, char *argv[])
 
 static bool do_ascend(int argc, char *argv[])
 {
+    if (ring_rejects(argv[0]) || chunked_rejects(argv[0]))
+        return false;
     if (argc != 1) {
         report(1, "%s takes too much arguments", argv[0]);
         return false;
@@ -836,12 +1372,13 @@ static bool do_ascend(int argc, char *argv[])
 
     if (exception_setup(true))
         current->size = q_ascend(current->q);
-    set_noallocate_mode(false);
+    exception_cancel();
 
     bool ok = true;
 
     cnt = current->size;
     if (current->size) {
+        q_materialize(current->q);
         for (struct list_head *cur_l = current->q->next;
              cur_l != current->q && --cnt; cur_l = cur_l->next) {
             element_t *item, *next_item;
@@ -862,6 +1399,8 @@ static bool do_ascend(int argc, char *argv[])
 
 static bool do_descend(int argc, char *argv[])
 {
+    if (ring_rejects(argv[0]) || chunked_rejects(argv[0]))
+        return false;
     if (argc != 1) {
         report(1, "%s takes too much arguments", argv[0]);
         return false;
@@ -883,12 +1422,13 @@ static bool do_descend(int argc, char *argv[])
 
     if (exception_setup(true))
         current->size = q_descend(current->q);
-    set_noallocate_mode(false);
+    exception_cancel();
 
     bool ok = true;
 
     cnt = current->size;
     if (current->size) {
+        q_materialize(current->q);
         for (struct list_head *cur_l = current->q->next;
              cur_l != current->q && --cnt; cur_l = cur_l->next) {
             element_t *item, *next_item;
@@ -909,6 +1449,8 @@ static bool do_descend(int argc, char *argv[])
 
 static bool do_reverseK(int argc, char *argv[])
 {
+    if (ring_rejects(argv[0]) || chunked_rejects(argv[0]))
+        return false;
     int k = 0;
 
     if (!current || !current->q) {
@@ -937,6 +1479,39 @@ static bool do_reverseK(int argc, char *argv[])
     return !error_check();
 }
 
+/* Start of the current round of a pairwise merge */
+static double merge_timer;
+
+/* Report the time each round of a pairwise merge takes, at verbosity 3 */
+static void merge_round_report(int round, int from, int to)
+{
+    report(3, "Merge round %d: %d lists into %d in %.6f seconds", round, from,
+           to, delta_time(&merge_timer));
+}
+
+/* Report that the merged queue is out of order at item, followed by
+ * next_item, if it is
+ */
+static bool merge_misordered(const char *item, const char *next_item)
+{
+    if (!descend && strcmp(item, next_item) > 0) {
+        report(1,
+               "ERROR: Not sorted in ascending order (It might because "
+               "of unsorted queues are merged or there're some flaws "
+               "in 'q_merge')");
+        return true;
+    }
+
+    if (descend && strcmp(item, next_item) < 0) {
+        report(1,
+               "ERROR: Not sorted in descending order (It might because "
+               "of unsorted queues are merged or there're some flaws "
+               "in 'q_merge')");
+        return true;
+    }
+    return false;
+}
+
 static bool do_merge(int argc, char *argv[])
 {
     if (argc != 1) {
@@ -950,14 +1525,55 @@ static bool do_merge(int argc, char *argv[])
     }
     error_check();
 
+    queue_contex_t *ctx;
+    int chunked = 0, total = 0;
+    list_for_each_entry(ctx, &chain.head, chain) {
+        if (ring_of(ctx)) {
+            report(1, "ERROR: Queue %d is a ring queue, which cannot be merged",
+                   ctx->id);
+            return false;
+        }
+        chunked += !!chunked_of(ctx);
+        total += ctx->size;
+    }
+    if (chunked && chunked != chain.size) {
+        report(1, "ERROR: Chunked queues can only be merged with each other");
+        return false;
+    }
+
+    /* q_chunked_merge() sorts through a scratch area, allocated up front */
+    chunked_t **chunks = NULL;
+    void *scratch = NULL;
+    size_t scratch_size = q_chunked_sort_scratch(total);
+    if (chunked) {
+        chunks = malloc(sizeof(chunked_t *) * chunked);
+        scratch = malloc(scratch_size);
+        if (!chunks || !scratch) {
+            free(chunks);
+            free(scratch);
+            report(1,
+                   "INTERNAL ERROR.  Could not allocate scratch area for "
+                   "merging");
+            return false;
+        }
+        int i = 0;
+        list_for_each_entry(ctx, &chain.head, chain)
+            chunks[i++] = chunked_of(ctx);
+    }
+
     int len = 0;
+    init_time(&merge_timer);
     set_noallocate_mode(true);
     if (current && exception_setup(true))
-        len = q_merge(&chain.head, descend);
+        len = chunks ? q_chunked_merge(chunks, chunked, descend, scratch,
+                                       scratch_size)
+                     : q_merge(&chain.head, descend);
     exception_cancel();
     set_noallocate_mode(false);
+    free(chunks);
+    free(scratch);
 
-    if (q_size(&chain.head) > 1) {
+    if (chain.size > 1) {
         chain.size = 1;
         current = list_entry(chain.head.next, queue_contex_t, chain);
         current->size = len;
@@ -967,6 +1583,7 @@ static bool do_merge(int argc, char *argv[])
             queue_contex_t *ctx = list_entry(cur, queue_contex_t, chain);
             cur = cur->next;
             q_free(ctx->q);
+            q_chunked_free(chunked_of(ctx));
             free(ctx);
         }
 
@@ -975,29 +1592,23 @@ static bool do_merge(int argc, char *argv[])
     }
 
     bool ok = true;
-    if (current && current->size) {
+    if (current && current->size && chunked_of(current)) {
+        for (int i = 0; i + 1 < len; i++) {
+            if (merge_misordered(variant_at(current, i),
+                                 variant_at(current, i + 1))) {
+                ok = false;
+                break;
+            }
+        }
+    } else if (current && current->size) {
+        q_materialize(current->q);
         for (struct list_head *cur_l = current->q->next;
              cur_l != current->q && --len; cur_l = cur_l->next) {
             /* Ensure each element in ascending order */
             element_t *item, *next_item;
             item = list_entry(cur_l, element_t, list);
             next_item = list_entry(cur_l->next, element_t, list);
-            if (!descend && strcmp(item->value, next_item->value) > 0) {
-                report(1,
-                       "ERROR: Not sorted in ascending order (It might because "
-                       "of unsorted queues are merged or there're some flaws "
-                       "in 'q_merge')");
-                ok = false;
-                break;
-            }
-
-
-            if (descend && strcmp(item->value, next_item->value) < 0) {
-                report(
-                    1,
-                    "ERROR: Not sorted in descending order (It might because "
-                    "of unsorted queues are merged or there're some flaws "
-                    "in 'q_merge')");
+            if (merge_misordered(item->value, next_item->value)) {
                 ok = false;
                 break;
             }
@@ -1010,8 +1621,10 @@ static bool do_merge(int argc, char *argv[])
 
 static bool do_shuffle(int argc, char *argv[])
 {
-    if (argc != 1) {
-        report(1, "%s takes no arguments", argv[0]);
+    if (ring_rejects(argv[0]) || chunked_rejects(argv[0]))
+        return false;
+    if (argc != 1 && argc != 2) {
+        report(1, "%s takes 0-1 arguments", argv[0]);
         return false;
     }
     if (!current || !current->q) {
@@ -1019,9 +1632,25 @@ static bool do_shuffle(int argc, char *argv[])
         return false;
     }
 
+    /* Seeded once per process, then carried over from shuffle to shuffle */
+    static uintptr_t shuffle_state;
+    static bool shuffle_seeded = false;
+    if (argc == 2) {
+        int seed;
+        if (!get_int(argv[1], &seed)) {
+            report(1, "Invalid seed '%s'", argv[1]);
+            return false;
+        }
+        shuffle_state = (uintptr_t) seed;
+        shuffle_seeded = true;
+    } else if (!shuffle_seeded) {
+        randombytes((uint8_t *) &shuffle_state, sizeof(shuffle_state));
+        shuffle_seeded = true;
+    }
+
     set_noallocate_mode(true);
     if (current && exception_setup(true))
-        q_shuffle(current->q);
+        q_shuffle(current->q, &shuffle_state);
     exception_cancel();
 
     set_noallocate_mode(false);
@@ -1065,10 +1694,30 @@ static bool q_show(int vlevel)
         return true;
     }
 
+    if (ring_of(current) || chunked_of(current)) {
+        report_noreturn(vlevel, "l = [");
+        int size = variant_size(current);
+        for (cnt = 0; cnt < size && cnt < BIG_LIST_SIZE; cnt++) {
+            const char *value = variant_at(current, cnt);
+            report_noreturn(vlevel, cnt == 0 ? "%s" : " %s", value);
+            if (show_entropy)
+                report_noreturn(vlevel, "(%3.2f%%)",
+                                shannon_entropy((const uint8_t *) value));
+        }
+        report(vlevel, size > BIG_LIST_SIZE ? " ... ]" : "]");
+        if (size != current->size) {
+            report(vlevel, "ERROR:  Queue has %d elements, expected %d", size,
+                   current->size);
+            ok = false;
+        }
+        return ok;
+    }
+
     if (!is_circular()) {
         report(vlevel, "ERROR:  Queue is not doubly circular");
         return false;
     }
+    q_materialize(current->q);
 
     report_noreturn(vlevel, "l = [");
 
@@ -1113,6 +1762,74 @@ static bool q_show(int vlevel)
     return ok;
 }
 
+static bool do_allocs(int argc, char *argv[])
+{
+    bool live_only = argc == 2 && !strcmp(argv[1], "live");
+    if (argc != 1 && !live_only) {
+        report(1, "%s takes no arguments but live", argv[0]);
+        return false;
+    }
+
+    allocation_profile(0, live_only);
+    return true;
+}
+
+/* Print how many of the bytes taken per block were requested */
+static void report_stats(int vlevel, const char *what, const alloc_stats_t *st)
+{
+    size_t slack = st->usable - st->requested - st->overhead;
+    report(vlevel,
+           "%s: %zu blocks, %zu bytes requested, %zu of headers and footers, "
+           "%zu of rounding (%.1f%% internal fragmentation)",
+           what, st->requests, st->requested, st->overhead, slack,
+           st->usable ? 100.0 * (st->usable - st->requested) / st->usable : 0);
+}
+
+static bool do_histogram(int argc, char *argv[])
+{
+    if (argc > 2) {
+        report(1, "%s takes at most one argument", argv[0]);
+        return false;
+    }
+
+    alloc_stats_t total, buckets[ALLOC_BUCKETS];
+    allocation_stats(&total, buckets);
+
+    FILE *csv = NULL;
+    if (argc == 2) {
+        csv = fopen(argv[1], "w");
+        if (!csv) {
+            report(1, "ERROR: Could not open '%s'", argv[1]);
+            return false;
+        }
+        fprintf(csv, "min_size,max_size,requests,requested,overhead,usable\n");
+    } else {
+        report(0, "%10s %10s %10s %12s %12s %12s", "Min size", "Max size",
+               "Requests", "Requested", "Overhead", "Usable");
+    }
+
+    for (int i = 0; i < ALLOC_BUCKETS; i++) {
+        const alloc_stats_t *b = &buckets[i];
+        if (!b->requests)
+            continue;
+        size_t lo = i ? (size_t) 1 << (i - 1) : 0;
+        size_t hi = i ? lo * 2 - 1 : 0;
+        if (csv)
+            fprintf(csv, "%zu,%zu,%zu,%zu,%zu,%zu\n", lo, hi, b->requests,
+                    b->requested, b->overhead, b->usable);
+        else
+            report(0, "%10zu %10zu %10zu %12zu %12zu %12zu", lo, hi,
+                   b->requests, b->requested, b->overhead, b->usable);
+    }
+
+    if (csv) {
+        fclose(csv);
+        return true;
+    }
+    report_stats(0, "Total", &total);
+    return true;
+}
+
 static bool do_show(int argc, char *argv[])
 {
     if (argc != 1) {
@@ -1174,7 +1891,10 @@ static bool do_next(int argc, char *argv[])
 
 static void console_init()
 {
-    ADD_COMMAND(new, "Create new queue", "");
+    ADD_COMMAND(new,
+                "Create new queue, kept in a ring buffer with ring or in an "
+                "unrolled list with chunked",
+                "[ring|chunked]");
     ADD_COMMAND(free, "Delete queue", "");
     ADD_COMMAND(prev, "Switch to previous queue", "");
     ADD_COMMAND(next, "Switch to next queue", "");
@@ -1199,7 +1919,10 @@ static void console_init()
     ADD_COMMAND(size, "Compute queue size n times (default: n == 1)", "[n]");
     ADD_COMMAND(show, "Show queue contents", "");
     ADD_COMMAND(dm, "Delete middle node in queue", "");
-    ADD_COMMAND(dedup, "Delete all nodes that have duplicate string", "");
+    ADD_COMMAND(dedup,
+                "Delete all nodes that have duplicate string. With hash, the "
+                "queue need not be sorted",
+                "[hash]");
     ADD_COMMAND(merge, "Merge all the queues into one sorted queue", "");
     ADD_COMMAND(swap, "Swap every two adjacent nodes in queue", "");
     ADD_COMMAND(ascend,
@@ -1212,14 +1935,48 @@ static void console_init()
                 "");
     ADD_COMMAND(reverseK, "Reverse the nodes of the queue 'K' at a time",
                 "[K]");
-    ADD_COMMAND(shuffle, "Shuffle entire queue.", "");
+    ADD_COMMAND(shuffle,
+                "Shuffle entire queue. Use seed to reproduce a permutation",
+                "[seed]");
     ADD_COMMAND(listsort, "List_sorting from linux kernel.", "");
+    ADD_COMMAND(arraysort,
+                "Sort queue through an array of key prefixes and nodes", "");
+    ADD_COMMAND(radixsort, "Sort queue by MSD radix sort", "");
+    ADD_COMMAND(histogram,
+                "Show requests to the allocator by log2 of their size, or "
+                "write them to CSV file",
+                "[file]");
+    ADD_COMMAND(allocs,
+                "Show blocks allocated by each call site, only of those "
+                "still holding some with live",
+                "[live]");
     add_param("length", &string_length, "Maximum length of displayed string",
               NULL);
     add_param("malloc", &fail_probability, "Malloc failure probability percent",
               NULL);
+    add_param("pool", &slab_pool, "Serve small blocks from slab pool", NULL);
+    add_param("fragment", &frag_report,
+              "Report internal fragmentation of each command's allocations",
+              NULL);
+    add_param("cautious_rate", &cautious_rate,
+              "Check every Nth free and 1/N of blocks after each command "
+              "(0: every free)",
+              NULL);
+    add_param("time", &time_limit,
+              "Time limit in seconds for queue operations (0: none)", NULL);
     add_param("fail", &fail_limit,
               "Number of times allow queue operations to return false", NULL);
+    add_param("branchless", &list_sort_branchless,
+              "Merge without branching on comparisons in listsort", NULL);
+    add_param("keycache", &key_cache,
+              "Compare cached key prefixes in listsort", NULL);
+    add_param("threads", &q_threads,
+              "Number of threads sorting and merging may use", NULL);
+    add_param("lazy", &q_lazy,
+              "Reverse queue by flipping its reading direction", NULL);
+    add_param("mergemode", &q_merge_mode,
+              "Merge queues through a heap (0) or pairwise in rounds (1)",
+              NULL);
     add_param("descend", &descend,
               "Sort and merge queue in ascending/descending order", NULL);
 }
@@ -1249,13 +2006,42 @@ static void q_init()
     INIT_LIST_HEAD(&chain.head);
     signal(SIGSEGV, sigsegv_handler);
     signal(SIGALRM, sigalrm_handler);
+    q_merge_round = merge_round_report;
+}
+
+/* Report the fragmentation of the blocks allocated by each command */
+static bool frag_helper(int argc, char *argv[])
+{
+    alloc_stats_t now;
+    allocation_stats(&now, NULL);
+    if (frag_report && now.requests > frag_last.requests) {
+        alloc_stats_t delta = {
+            .requests = now.requests - frag_last.requests,
+            .requested = now.requested - frag_last.requested,
+            .overhead = now.overhead - frag_last.overhead,
+            .usable = now.usable - frag_last.usable,
+        };
+        report_stats(1, argv[0], &delta);
+    }
+    frag_last = now;
+    return true;
+}
+
+/* Look for corrupted blocks among those allocated after each command */
+static bool sweep_helper(int argc, char *argv[])
+{
+    bool ok = false;
+    if (exception_setup(false))
+        ok = allocation_sweep();
+    exception_cancel();
+    if (!ok)
+        error_check(); /* Already counted against this command */
+    return ok;
 }
 
 static bool q_quit(int argc, char *argv[])
 {
     report(3, "Freeing queue");
-    if (current && current->size > BIG_LIST_SIZE)
-        set_cautious_mode(false);
 
     if (exception_setup(true)) {
         struct list_head *cur = chain.head.next;
@@ -1263,18 +2049,20 @@ static bool q_quit(int argc, char *argv[])
             queue_contex_t *qctx = list_entry(cur, queue_contex_t, chain);
             cur = cur->next;
             q_free(qctx->q);
+            q_ring_free(ring_of(qctx));
+            q_chunked_free(chunked_of(qctx));
             free(qctx);
             chain.size--;
         }
     }
 
     exception_cancel();
-    set_cautious_mode(true);
 
     size_t bcnt = allocation_check();
     if (bcnt > 0) {
         report(1, "ERROR: Freed queue, but %lu blocks are still allocated",
                bcnt);
+        allocation_profile(1, true);
         return false;
     }
 
@@ -1554,6 +2342,8 @@ int main(int argc, char *argv[])
         set_logfile(logfile_name);
 
     add_quit_helper(q_quit);
+    add_cmd_helper(sweep_helper);
+    add_cmd_helper(frag_helper);
 
     bool ok = true;
     ok = ok && run_console(infile_name);
@@ -1,21 +1,104 @@
+#include <pthread.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "list_sort.h"
 #include "queue.h"
+#include "queue_ext.h"
 #include "random.h"
 
+/* Header of a queue created by q_new().
+ *
+ * Callers only ever see &qh->head, a plain struct list_head, while the
+ * element count is kept next to it by every operation that adds or deletes
+ * elements.  The queue operations below must therefore be given heads
+ * returned by q_new(); helpers working on temporary lists only use the
+ * list_head API.
+ *
+ * Two flags describe the queue beyond its links.  With q_lazy set,
+ * q_reverse() only toggles reversed, and the queue then reads from
+ * head->prev towards head->next: insertions and removals use the other end,
+ * sorts run in the other direction, and the remaining operations put the
+ * links back in order first, see q_straighten().  order records that the
+ * queue is known to be sorted, so that sorting it again the same way is
+ * free.
+ */
+typedef struct {
+    struct list_head head;
+    int size;
+    bool reversed; /* The queue reads backwards along its links */
+    int order;     /* 1 if known ascending, -1 if descending, 0 if unknown */
+} queue_head_t;
+
+#define q_head(h) container_of(h, queue_head_t, head)
+
+int q_lazy = 0;
+
+/* Reverse the links of the list, head included */
+static void q_reverse_links(struct list_head *head)
+{
+    struct list_head *node = head;
+    do {
+        struct list_head *next = node->next;
+        node->next = node->prev;
+        node->prev = next;
+        node = next;
+    } while (node != head);
+}
+
+/* Make the links of the queue follow its order, for operations that walk
+ * it from one end.  The known order is kept.
+ */
+static void q_straighten(struct list_head *head)
+{
+    queue_head_t *qh = q_head(head);
+    if (qh->reversed) {
+        q_reverse_links(head);
+        qh->reversed = false;
+    }
+}
+
+void q_materialize(struct list_head *head)
+{
+    if (head)
+        q_straighten(head);
+}
+
+/* Link node in at the head or the tail of the queue as it reads */
+static inline void q_link(struct list_head *head,
+                          struct list_head *node,
+                          bool at_head)
+{
+    queue_head_t *qh = q_head(head);
+    if (at_head != qh->reversed)
+        list_add(node, head);
+    else
+        list_add_tail(node, head);
+    qh->size++;
+    qh->order = 0;
+}
+
+/* Node at the head or the tail of the non-empty queue as it reads */
+static inline struct list_head *q_end(struct list_head *head, bool at_head)
+{
+    return at_head != q_head(head)->reversed ? head->next : head->prev;
+}
+
 /* Create an empty queue */
 struct list_head *q_new()
 {
-    struct list_head *head = malloc(sizeof(struct list_head));
-    if (!head) {
+    queue_head_t *qh = malloc(sizeof(queue_head_t));
+    if (!qh) {
         return NULL;
     }
-    INIT_LIST_HEAD(head);
+    INIT_LIST_HEAD(&qh->head);
+    qh->size = 0;
+    qh->reversed = false;
+    qh->order = 0;
 
-    return (head);
+    return (&qh->head);
 }
 
 /* Free all storage used by queue */
@@ -28,27 +111,54 @@ void q_free(struct list_head *head)
             cur = cur->next;
             q_release_element(ele);
         }
-        free(head);
+        free(q_head(head));
+    }
+}
+
+/* Copy the len bytes of src into dst, which has room for size bytes.
+ * At most size - 1 bytes are copied, and dst is always null-terminated.
+ */
+static inline void q_copy_string(char *dst,
+                                 const char *src,
+                                 size_t len,
+                                 size_t size)
+{
+    if (len >= size)
+        len = size - 1;
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+/* Allocate an element holding a copy of the first len bytes of s.
+ *
+ * The string cannot be stored inline in the node: q_release_element() in
+ * queue.h frees e->value and e as two separate blocks, so both have to come
+ * from their own allocation.
+ */
+static element_t *q_new_element(const char *s, size_t len)
+{
+    element_t *new_node = malloc(sizeof(element_t));
+    if (!new_node)
+        return NULL;
+    new_node->value = malloc(len + 1);
+    if (!new_node->value) {
+        free(new_node);
+        return NULL;
     }
+    q_copy_string(new_node->value, s, len, len + 1);
+
+    return new_node;
 }
 
 /* Insert an element at head of queue */
 bool q_insert_head(struct list_head *head, char *s)
 {
-    // element_t *new_node = malloc(sizeof(element_t));
     if (!head || !s)
         return false;
-    element_t *new_node = malloc(sizeof(element_t));
+    element_t *new_node = q_new_element(s, strlen(s));
     if (!new_node)
         return false;
-    new_node->value = malloc(strlen(s) + 1);
-    if (!new_node->value) {
-        free(new_node);
-        return false;
-    }
-    strncpy(new_node->value, s, strlen(s));
-    new_node->value[strlen(s)] = '\0';
-    list_add(&new_node->list, head);
+    q_link(head, &new_node->list, true);
 
     return true;
 }
@@ -58,32 +168,74 @@ bool q_insert_tail(struct list_head *head, char *s)
 {
     if (!head || !s)
         return false;
-    element_t *new_node = malloc(sizeof(element_t));
-    if (!new_node)
+    return q_insert_tail_n(head, s, strlen(s));
+}
+
+/* Insert an element holding the first len bytes of s at tail of queue */
+bool q_insert_tail_n(struct list_head *head, const char *s, size_t len)
+{
+    if (!head || !s)
         return false;
-    new_node->value = malloc(strlen(s) + 1);
-    if (!new_node->value) {
-        free(new_node);
+    element_t *new_node = q_new_element(s, len);
+    if (!new_node)
         return false;
-    }
-    strncpy(new_node->value, s, strlen(s));
-    new_node->value[strlen(s)] = '\0';
-    list_add_tail(&new_node->list, head);
+    q_link(head, &new_node->list, false);
 
     return true;
 }
 
+/* Link copies of s[0..n-1] in at either end.  Each element joins the queue
+ * as soon as it is built, so an interrupted batch leaves none unreachable.
+ */
+static int q_insert_bulk(struct list_head *head, char **s, int n, bool at_head)
+{
+    if (!head || !s)
+        return 0;
+
+    /* A queue that reads backwards has its head at the tail of the links */
+    queue_head_t *qh = q_head(head);
+    at_head ^= qh->reversed;
+
+    int cnt = 0;
+    for (int i = 0; i < n; i++) {
+        element_t *new_node = s[i] ? q_new_element(s[i], strlen(s[i])) : NULL;
+        if (!new_node)
+            continue;
+        if (at_head)
+            list_add(&new_node->list, head);
+        else
+            list_add_tail(&new_node->list, head);
+        qh->size++;
+        qh->order = 0;
+        cnt++;
+    }
+
+    return cnt;
+}
+
+/* Insert a batch of elements at head of queue */
+int q_insert_head_bulk(struct list_head *head, char **s, int n)
+{
+    return q_insert_bulk(head, s, n, true);
+}
+
+/* Insert a batch of elements at tail of queue */
+int q_insert_tail_bulk(struct list_head *head, char **s, int n)
+{
+    return q_insert_bulk(head, s, n, false);
+}
+
 /* Remove an element from head of queue */
 element_t *q_remove_head(struct list_head *head, char *sp, size_t bufsize)
 {
     if (!head || (head->next == head))
         return NULL;
-    element_t *ele = container_of(head->next, element_t, list);
-    if (sp) {
-        strncpy(sp, ele->value, bufsize - 1);
-        sp[bufsize - 1] = '\0';
-    }
+    element_t *ele = container_of(q_end(head, true), element_t, list);
+    if (sp && bufsize)
+        q_copy_string(sp, ele->value, strnlen(ele->value, bufsize - 1),
+                      bufsize);
     list_del(&ele->list);
+    q_head(head)->size--;
 
     return ele;
 }
@@ -93,12 +245,12 @@ element_t *q_remove_tail(struct list_head *head, char *sp, size_t bufsize)
 {
     if (!head || (head->next == head))
         return NULL;
-    element_t *ele = container_of(head->prev, element_t, list);
-    if (sp) {
-        strncpy(sp, ele->value, bufsize - 1);
-        sp[bufsize - 1] = '\0';
-    }
+    element_t *ele = container_of(q_end(head, false), element_t, list);
+    if (sp && bufsize)
+        q_copy_string(sp, ele->value, strnlen(ele->value, bufsize - 1),
+                      bufsize);
     list_del(&ele->list);
+    q_head(head)->size--;
 
     return ele;
 }
@@ -108,12 +260,8 @@ int q_size(struct list_head *head)
 {
     if (!head)
         return 0;
-    int cnt = 0;
-    struct list_head *cur;
-    list_for_each(cur, head)
-        cnt++;
 
-    return cnt;
+    return q_head(head)->size;
 }
 
 /* Delete the middle node in queue */
@@ -122,6 +270,7 @@ bool q_delete_mid(struct list_head *head)
     if (!head || head->next == head)
         return NULL;
 
+    q_straighten(head);
     struct list_head *ptr = head->next;
     for (const struct list_head *fast = head->next;
          fast->next != head && fast->next->next != head;
@@ -132,6 +281,7 @@ bool q_delete_mid(struct list_head *head)
     list_del(ptr);
     free(ele->value);
     free(ele);
+    q_head(head)->size--;
 
     return true;
 }
@@ -155,6 +305,7 @@ bool q_delete_dup(struct list_head *head)
             tmp = ptr->next;
             list_del(ptr);
             q_release_element(dup);
+            q_head(head)->size--;
             ptr = tmp;
             dup = list_entry(ptr, element_t, list);
             safe = dup;
@@ -162,8 +313,84 @@ bool q_delete_dup(struct list_head *head)
         if (check) {
             list_del(&ele->list);
             q_release_element(ele);
+            q_head(head)->size--;
+        }
+    }
+    return true;
+}
+
+/* Slot of the open-addressing set used by q_delete_dup_hash() */
+typedef struct {
+    uintptr_t hash;
+    element_t *first; /* First element holding the string, NULL if unused */
+    bool dup;
+} dedup_slot_t;
+
+/* FNV-1a over the string, finished with random_shuffle() so that the low
+ * bits used to index the set depend on every byte.
+ */
+static inline uintptr_t dedup_hash(const char *s)
+{
+#if M_INTPTR_SIZE == 8
+    uintptr_t h = 0xcbf29ce484222325UL;
+    for (; *s; s++)
+        h = (h ^ (unsigned char) *s) * 0x100000001b3UL;
+#else
+    uintptr_t h = 0x811c9dc5UL;
+    for (; *s; s++)
+        h = (h ^ (unsigned char) *s) * 0x01000193UL;
+#endif
+    return random_shuffle(h);
+}
+
+/* Delete all nodes that have duplicate string, in any order.
+ *
+ * One pass looks every string up in a linear-probing set of at least twice
+ * the queue size.  Repeats are unlinked as they are met, and so is the first
+ * occurrence once its string turns out to be repeated; unlinked nodes are
+ * kept on a local list until the pass is over, because the set still
+ * compares against their strings.
+ */
+bool q_delete_dup_hash(struct list_head *head)
+{
+    if (!head || list_empty(head))
+        return false;
+
+    size_t cap = 2;
+    while (cap < 2 * (size_t) q_size(head))
+        cap <<= 1;
+    dedup_slot_t *set = calloc(cap, sizeof(dedup_slot_t));
+    if (!set)
+        return false;
+
+    LIST_HEAD(dead);
+    element_t *ele, *safe;
+    list_for_each_entry_safe(ele, safe, head, list) {
+        uintptr_t hash = dedup_hash(ele->value);
+        size_t i = hash & (cap - 1);
+        for (; set[i].first; i = (i + 1) & (cap - 1)) {
+            if (set[i].hash == hash &&
+                !strcmp(set[i].first->value, ele->value))
+                break;
+        }
+
+        if (!set[i].first) {
+            set[i].hash = hash;
+            set[i].first = ele;
+            continue;
         }
+        if (!set[i].dup) {
+            set[i].dup = true;
+            list_move_tail(&set[i].first->list, &dead);
+            q_head(head)->size--;
+        }
+        list_move_tail(&ele->list, &dead);
+        q_head(head)->size--;
     }
+
+    free(set);
+    list_for_each_entry_safe(ele, safe, &dead, list)
+        q_release_element(ele);
     return true;
 }
 
@@ -171,6 +398,8 @@ bool q_delete_dup(struct list_head *head)
 void q_swap(struct list_head *head)
 {
     if (head && !list_empty(head) && !list_is_singular(head)) {
+        q_straighten(head);
+        q_head(head)->order = 0;
         struct list_head *one = head->next;
         struct list_head *two = one->next;
         while (one != head && two != head) {
@@ -186,268 +415,1303 @@ void q_swap(struct list_head *head)
     }
 }
 
-/* Reverse elements in queue */
+/* Reverse elements in queue
+ *
+ * With q_lazy set, or when the queue already reads backwards, only the
+ * reversed flag of the queue is toggled.  A sorted queue stays sorted the
+ * other way.
+ */
 void q_reverse(struct list_head *head)
 {
-    if (head && !list_empty(head)) {
-        struct list_head *end = head->next;
-        struct list_head *target = end->next;
-        while (end->next != head) {
-            list_move(target, head);
-            target = end->next;
-        }
+    if (!head || list_empty(head))
+        return;
+
+    queue_head_t *qh = q_head(head);
+    qh->order = -qh->order;
+    if (q_lazy || qh->reversed) {
+        qh->reversed = !qh->reversed;
+        return;
+    }
+
+    struct list_head *end = head->next;
+    struct list_head *target = end->next;
+    while (end->next != head) {
+        list_move(target, head);
+        target = end->next;
     }
 }
 
 /* Reverse the nodes of the list k at a time */
 void q_reverseK(struct list_head *head, int k)
 {
-    if (!head || list_empty(head) || list_is_singular(head))
+    if (!head || list_empty(head) || list_is_singular(head) || k < 2)
         return;
-
-    struct list_head *start, *end;
-    LIST_HEAD(trans);
-    LIST_HEAD(tmp);
-    while (q_size(head) >= k) {
-        start = head->next;
-        end = start;
-        for (int i = 1; i < k; i++) {
-            end = end->next;
-        }
-        list_cut_position(&trans, head, end);
-        q_reverse(&trans);
-        list_splice_tail_init(&trans, &tmp);
+    q_straighten(head);
+    q_head(head)->order = 0;
+
+    /* Reverse each full group in place by moving the node following its
+     * first node right behind the group's predecessor, k - 1 times.  The
+     * first node then ends up last and becomes the next predecessor.
+     */
+    struct list_head *prev = head;
+    for (int remain = q_size(head); remain >= k; remain -= k) {
+        struct list_head *first = prev->next;
+        for (int i = 1; i < k; i++)
+            list_move(first->next, prev);
+        prev = first;
     }
-    list_splice_tail_init(head, &tmp);
-    list_splice_tail(&tmp, head);
 }
 
-/* Merge two lists in ascending order */
-struct list_head *mergeTwoLists(struct list_head *L1,
-                                struct list_head *L2,
+/* Compare the strings of two nodes in the order q_sort() arranges them */
+static inline int sort_cmp(const struct list_head *a,
+                           const struct list_head *b,
+                           bool descend)
+{
+    int cmp = strcmp(list_entry(a, element_t, list)->value,
+                     list_entry(b, element_t, list)->value);
+    return descend ? -cmp : cmp;
+}
+
+/* Consecutive wins by one side of a merge before it starts galloping */
+#define MIN_GALLOP 7
+
+/* Find the longest prefix of the null-terminated list x whose nodes all
+ * compare less than bound against key, i.e. go before key when bound is 0
+ * and do not go after it when bound is 1.  Probes at exponentially growing
+ * distances, then binary searches the last gap, so a prefix of length m costs
+ * O(log m) comparisons, though still O(m) pointer steps.
+ *
+ * Return: the last node of the prefix, or NULL if x itself does not qualify
+ */
+static struct list_head *gallop(struct list_head *x,
+                                const struct list_head *key,
+                                int bound,
                                 bool descend)
 {
-    element_t *L1_ele = list_entry(L1->next, element_t, list),
-              *L2_ele = list_entry(L2->next, element_t, list), *next;
-    while (&L1_ele->list != L1 && &L2_ele->list != L2) {
-        if ((strcmp(L1_ele->value, L2_ele->value) <= 0) ^ descend) {
-            L1_ele = list_entry(L1_ele->list.next, element_t, list);
+    struct list_head *last = NULL, *probe = x;
+    size_t step = 1, unknown = 0;
+
+    while (probe && sort_cmp(probe, key, descend) < bound) {
+        last = probe;
+        for (unknown = 0; unknown < step && probe; unknown++)
+            probe = probe->next;
+        step <<= 1;
+    }
+    if (!last)
+        return NULL;
+
+    /* Nodes strictly between last and probe are still undecided */
+    for (unknown--; unknown;) {
+        size_t half = unknown / 2;
+        struct list_head *mid = last->next;
+        for (size_t i = 0; i < half; i++)
+            mid = mid->next;
+        if (sort_cmp(mid, key, descend) < bound) {
+            last = mid;
+            unknown -= half + 1;
         } else {
-            next = list_entry(L2_ele->list.next, element_t, list);
-            list_move(&L2_ele->list, L1_ele->list.prev);
-            L2_ele = next;
+            unknown = half;
         }
     }
 
-    list_splice_tail_init(L2, L1);
+    return last;
+}
 
-    return L1;
+/* Append the nodes from first through last, which follow each other, after
+ * tail.  Their prev links are only restored when head is set.
+ *
+ * Return: the new tail, i.e. last
+ */
+static inline struct list_head *sort_append(struct list_head *head,
+                                            struct list_head *tail,
+                                            struct list_head *first,
+                                            struct list_head *last)
+{
+    tail->next = first;
+    if (head) {
+        for (; tail != last; first = first->next) {
+            first->prev = tail;
+            tail = first;
+        }
+    }
+    return last;
 }
 
-struct list_head *mergesort_list(struct list_head *head, bool descend)
+/* Stably merge the null-terminated runs a and b, where a comes first.
+ * Once a side has won MIN_GALLOP times in a row, the rest of its winning
+ * stretch is found by gallop() and moved over in one piece.
+ *
+ * For the last merge of a sort, head is the queue: like merge_final() of
+ * list_sort, the prev links are then restored on the way while the nodes
+ * are still in cache, and the result is closed into the circular list
+ * behind head.  Otherwise head is NULL and the merged run is returned
+ * null-terminated.
+ */
+static struct list_head *sort_merge(struct list_head *head,
+                                    struct list_head *a,
+                                    struct list_head *b,
+                                    bool descend)
 {
-    if (!head || list_empty(head) || list_is_singular(head))
-        return head;
+    struct list_head dummy, *tail = head ? head : &dummy, *last;
+    int a_wins = 0, b_wins = 0;
 
+    while (a && b) {
+        if (sort_cmp(a, b, descend) <= 0) {
+            tail = sort_append(head, tail, a, a);
+            a = a->next;
+            b_wins = 0;
+            if (++a_wins < MIN_GALLOP || !a)
+                continue;
+            if ((last = gallop(a, b, 1, descend))) {
+                tail = sort_append(head, tail, a, last);
+                a = last->next;
+            }
+            a_wins = 0;
+        } else {
+            tail = sort_append(head, tail, b, b);
+            b = b->next;
+            a_wins = 0;
+            if (++b_wins < MIN_GALLOP || !b)
+                continue;
+            if ((last = gallop(b, a, 0, descend))) {
+                tail = sort_append(head, tail, b, last);
+                b = last->next;
+            }
+            b_wins = 0;
+        }
+    }
 
-    struct list_head *slow = head;
-    for (const struct list_head *fast = head->next;
-         fast != head && fast->next != head; fast = fast->next->next)
-        slow = slow->next;
+    struct list_head *rest = a ? a : b;
+    if (!head) {
+        tail->next = rest;
+        return dummy.next;
+    }
+    for (; rest; rest = rest->next)
+        tail = sort_append(head, tail, rest, rest);
+    tail->next = head;
+    head->prev = tail;
+    return head->next;
+}
+
+/* Shortest run sort_run() returns while nodes remain */
+#define MIN_RUN 32
+
+/* Detach the run at the start of the null-terminated list *list and advance
+ * *list past it.  The run is maximal in natural order, or strictly
+ * descending and then reversed in place; keeping equal strings out of a
+ * descending run is what keeps the sort stable.  Runs shorter than MIN_RUN,
+ * as found in random input, are extended to MIN_RUN nodes by binary
+ * insertion, which needs fewer comparisons than merging tiny runs.
+ *
+ * Return: the run, in sorted order, with its length stored in *len
+ */
+static struct list_head *sort_run(struct list_head **list,
+                                  size_t *len,
+                                  bool descend)
+{
+    struct list_head *run = *list, *cur = run, *next = run->next;
+    size_t n = 1;
+
+    if (next && sort_cmp(next, cur, descend) < 0) {
+        /* Reverse while the run keeps descending strictly */
+        cur->next = NULL;
+        do {
+            struct list_head *tmp = next->next;
+            next->next = cur;
+            cur = next;
+            next = tmp;
+            n++;
+        } while (next && sort_cmp(next, cur, descend) < 0);
+        run->next = NULL;
+        run = cur;
+    } else {
+        while (next && sort_cmp(next, cur, descend) >= 0) {
+            cur = next;
+            next = next->next;
+            n++;
+        }
+        cur->next = NULL;
+    }
 
+    if (n < MIN_RUN && next) {
+        struct list_head *sorted[MIN_RUN];
+        size_t i = 0;
+        for (cur = run; cur; cur = cur->next)
+            sorted[i++] = cur;
+        for (; n < MIN_RUN && next; n++, next = next->next) {
+            /* Insert after any equal string, for stability */
+            size_t lo = 0, hi = n;
+            while (lo < hi) {
+                size_t mid = (lo + hi) / 2;
+                if (sort_cmp(next, sorted[mid], descend) < 0)
+                    hi = mid;
+                else
+                    lo = mid + 1;
+            }
+            memmove(&sorted[lo + 1], &sorted[lo], (n - lo) * sizeof(*sorted));
+            sorted[lo] = next;
+        }
+        for (i = 0; i + 1 < n; i++)
+            sorted[i]->next = sorted[i + 1];
+        sorted[n - 1]->next = NULL;
+        run = sorted[0];
+    }
 
-    LIST_HEAD(cut);
-    cut.prev = head->prev;
-    head->prev->next = &cut;
-    slow->next->prev = &cut;
-    cut.next = slow->next;
-    slow->next = head;
-    head->prev = slow;
+    *list = next;
+    *len = n;
+    return run;
+}
 
+/* Sort the null-terminated list by a natural merge sort in the manner of
+ * TimSort: the list is cut into runs by sort_run(), and the runs are merged
+ * on a stack that keeps the lengths of its entries growing at least like the
+ * Fibonacci numbers, so merges stay balanced.  A list that is already sorted
+ * is a single run and takes n - 1 comparisons; in general the cost is
+ * O(n log r) for r runs.
+ *
+ * With head set, the result is linked into the circular list behind head;
+ * otherwise it is returned null-terminated.
+ */
+static struct list_head *sort_list(struct list_head *head,
+                                   struct list_head *list,
+                                   bool descend)
+{
+    /* With run lengths growing like the Fibonacci numbers, 64 entries hold
+     * far more than the INT_MAX elements a queue can count.
+     */
+    struct list_head *stack[64];
+    size_t stack_len[64];
+    int top = 0;
+    bool linked = false;
+
+    while (list) {
+        stack[top] = sort_run(&list, &stack_len[top], descend);
+        top++;
+
+        /* Restore the invariants len[i - 2] > len[i - 1] + len[i] and
+         * len[i - 1] > len[i], also checking one entry deeper as in the fix
+         * of de Gouw et al. for the original TimSort.  With no runs left,
+         * collapse the whole stack.
+         */
+        while (top > 1) {
+            int n = top - 2;
+            if (list && !(n > 0 && stack_len[n - 1] <=
+                                       stack_len[n] + stack_len[n + 1]) &&
+                !(n > 1 &&
+                  stack_len[n - 2] <= stack_len[n - 1] + stack_len[n]) &&
+                stack_len[n] > stack_len[n + 1])
+                break;
+            if (n > 0 && stack_len[n - 1] < stack_len[n + 1])
+                n--;
+            /* The last merge also relinks the queue */
+            linked = head && !list && top == 2;
+            stack[n] = sort_merge(linked ? head : NULL, stack[n],
+                                  stack[n + 1], descend);
+            stack_len[n] += stack_len[n + 1];
+            for (int i = n + 1; i < top - 1; i++) {
+                stack[i] = stack[i + 1];
+                stack_len[i] = stack_len[i + 1];
+            }
+            top--;
+        }
+    }
 
+    if (!head || linked)
+        return stack[0];
 
-    struct list_head *left = mergesort_list(head, descend),
-                     *right = mergesort_list(&cut, descend);
-    return mergeTwoLists(left, right, descend);
+    /* A single run still needs the prev links of the circular list */
+    struct list_head *prev = head;
+    head->next = stack[0];
+    for (list = stack[0]; list; list = list->next) {
+        list->prev = prev;
+        prev = list;
+    }
+    prev->next = head;
+    head->prev = prev;
+    return head->next;
 }
 
-/* Sort elements of queue in ascending/descending order */
-void q_sort(struct list_head *head, bool descend)
+int q_threads = 1;
+
+/* Most threads q_sort() runs at once, and fewest nodes it gives each */
+#define SORT_MAX_THREADS 64
+#define SORT_MIN_PER_THREAD 8192
+
+/* Sorting or merging done by one thread of sort_parallel() */
+typedef struct {
+    pthread_t thread;
+    struct list_head *a, *b; /* Merge b after a, or sort a if b is NULL */
+    bool descend;
+} sort_task_t;
+
+static void *sort_task(void *arg)
 {
-    if (!head || list_empty(head) || list_is_singular(head))
-        return;
+    sort_task_t *task = arg;
 
-    mergesort_list(head, descend);
+    if (task->b)
+        task->a = sort_merge(NULL, task->a, task->b, task->descend);
+    else
+        task->a = sort_list(NULL, task->a, task->descend);
+    return NULL;
 }
 
-/* Remove every node which has a node with a strictly less value anywhere to
- * the right side of it */
-int q_ascend(struct list_head *head)
+/* Run task[1..n-1] on threads of their own and task[0] on the calling one,
+ * then wait for all of them.  The asynchronous signals stay blocked in the
+ * calling thread, and so in the helper threads inheriting its mask, until
+ * every helper is joined: the time limit alarm of qtest jumps out of the
+ * calling thread, which must not leave helpers relinking nodes behind it.
+ * A task whose thread cannot be created runs in place.
+ */
+static void sort_tasks(sort_task_t *task, int n)
 {
-    if (head && !list_empty(head) && !list_is_singular(head)) {
-        struct list_head *cmp = head->next;
-        struct list_head *ptr = cmp->next;
-        element_t *left = NULL;
-        const element_t *right = NULL;
-        while (ptr != head) {
-            left = list_entry(cmp, element_t, list);
-            right = list_entry(ptr, element_t, list);
-            if (strcmp(left->value, right->value) > 0) {
-                list_del(cmp);
-                q_release_element(left);
-                cmp = head->next;
-                ptr = cmp->next;
-            } else {
-                cmp = ptr;
-                ptr = ptr->next;
-            }
-        }
+    sigset_t mask, old;
+    bool started[SORT_MAX_THREADS] = {false};
+
+    sigfillset(&mask);
+    sigdelset(&mask, SIGSEGV);
+    sigdelset(&mask, SIGBUS);
+    sigdelset(&mask, SIGFPE);
+    sigdelset(&mask, SIGILL);
+    pthread_sigmask(SIG_BLOCK, &mask, &old);
+    for (int i = 1; i < n; i++) {
+        started[i] =
+            !pthread_create(&task[i].thread, NULL, sort_task, &task[i]);
     }
 
-    return q_size(head);
+    sort_task(&task[0]);
+    for (int i = 1; i < n; i++) {
+        if (started[i])
+            pthread_join(task[i].thread, NULL);
+        else
+            sort_task(&task[i]);
+    }
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
 }
 
-/* Remove every node which has a node with a strictly greater value anywhere to
- * the right side of it */
-int q_descend(struct list_head *head)
+/* Sort the queue on threads threads: cut it into as many equal parts, sort
+ * them concurrently, and merge adjacent pairs concurrently until two parts
+ * are left for the last merge, which relinks the queue.  Merging only
+ * neighbours, the earlier one first, keeps the result stable and identical
+ * to that of sort_list() alone.
+ */
+static void sort_parallel(struct list_head *head, bool descend, int threads)
 {
-    if (head && !list_empty(head) && !list_is_singular(head)) {
-        struct list_head *cmp = head->next;
-        struct list_head *ptr = cmp->next;
-        element_t *left = NULL;
-        const element_t *right = NULL;
-        while (ptr != head) {
-            left = list_entry(cmp, element_t, list);
-            right = list_entry(ptr, element_t, list);
-            if (strcmp(left->value, right->value) < 0) {
-                list_del(cmp);
-                q_release_element(left);
-                cmp = head->next;
-                ptr = cmp->next;
-            } else {
-                cmp = ptr;
-                ptr = ptr->next;
-            }
+    sort_task_t task[SORT_MAX_THREADS];
+    struct list_head *part[SORT_MAX_THREADS];
+    int n = q_size(head), parts = threads;
+
+    head->prev->next = NULL;
+    struct list_head *node = head->next;
+    for (int i = 0; i < parts; i++) {
+        part[i] = node;
+        for (int len = n / parts + (i < n % parts); len > 1; len--)
+            node = node->next;
+        struct list_head *next = node->next;
+        node->next = NULL;
+        node = next;
+    }
+
+    for (int i = 0; i < parts; i++)
+        task[i] = (sort_task_t){.a = part[i], .b = NULL, .descend = descend};
+    sort_tasks(task, parts);
+    for (int i = 0; i < parts; i++)
+        part[i] = task[i].a;
+
+    while (parts > 2) {
+        int pairs = parts / 2;
+        for (int i = 0; i < pairs; i++) {
+            task[i] = (sort_task_t){
+                .a = part[2 * i], .b = part[2 * i + 1], .descend = descend};
         }
+        sort_tasks(task, pairs);
+        for (int i = 0; i < pairs; i++)
+            part[i] = task[i].a;
+        if (parts & 1)
+            part[pairs] = part[parts - 1];
+        parts = pairs + (parts & 1);
     }
 
-    return q_size(head);
+    sort_merge(head, part[0], part[1], descend);
 }
 
-/* Merge all the queues into one sorted queue, which is in ascending/descending
- * order */
-int q_merge(struct list_head *head, bool descend)
+/* Start sorting the queue in the order of descend: return false if it is
+ * known to be in that order already.  Otherwise, turn descend into the order
+ * the links have to be sorted in.  For a queue that reads backwards, that is
+ * the other order, since stably sorting the links one way and reading them
+ * backwards is the same as stably sorting them the other way.
+ */
+static inline bool sort_begin(struct list_head *head, bool *descend)
 {
-    if (list_is_singular(head)) {
-        queue_contex_t *q = list_entry(head->next, queue_contex_t, chain);
-        return q->size;
-    }
+    queue_head_t *qh = q_head(head);
+    if (qh->order == (*descend ? -1 : 1))
+        return false;
+    *descend ^= qh->reversed;
+    return true;
+}
 
-    struct list_head *q_c = NULL, *safe = NULL;
-    queue_contex_t *tmp = container_of(head->next, queue_contex_t, chain);
+/* Record that the queue, whose links were sorted in the order of descend,
+ * is sorted.
+ */
+static inline void sort_end(struct list_head *head, bool descend)
+{
+    queue_head_t *qh = q_head(head);
+    qh->order = descend != qh->reversed ? -1 : 1;
+}
 
+/* Sort elements of queue in ascending/descending order
+ *
+ * See sort_list().  Queues long enough to give every thread at least
+ * SORT_MIN_PER_THREAD nodes are sorted by up to q_threads threads.  The
+ * sort is stable and does not allocate.
+ */
+void q_sort(struct list_head *head, bool descend)
+{
+    if (!head || list_empty(head) || list_is_singular(head) ||
+        !sort_begin(head, &descend))
+        return;
 
-    list_for_each_safe(q_c, safe, head) {
-        if (q_c != head->next) {
-            queue_contex_t *merge = list_entry(q_c, queue_contex_t, chain);
-            mergeTwoLists(tmp->q, merge->q, descend);
-        }
+    int threads = q_threads < SORT_MAX_THREADS ? q_threads : SORT_MAX_THREADS;
+    if (threads > q_size(head) / SORT_MIN_PER_THREAD)
+        threads = q_size(head) / SORT_MIN_PER_THREAD;
+    if (threads > 1) {
+        sort_parallel(head, descend, threads);
+    } else {
+        head->prev->next = NULL;
+        sort_list(head, head->next, descend);
     }
+    sort_end(head, descend);
+}
 
-    return q_size(tmp->q);
+/* Entry of the array sorted by q_sort_array() */
+typedef struct {
+    uint64_t key; /* First 8 bytes of the string, big-endian, zero-padded */
+    struct list_head *node;
+} sort_pair_t;
+
+/* Blocks of this many pairs are insertion sorted before merging */
+#define ARRAY_SORT_BLOCK 16
+
+size_t q_sort_array_scratch(size_t n)
+{
+    return 2 * n * sizeof(sort_pair_t);
 }
 
-/* Shuffle elements in queue */
-void q_shuffle(struct list_head *head)
+/* Pack the first 8 bytes of s big-endian, so that comparing keys as
+ * integers orders them like strcmp() orders the prefixes.  Bytes past the
+ * terminator are never read.
+ */
+static inline uint64_t sort_key(const char *s)
 {
-    struct list_head *new = head->prev, *old = head->next, *tmp = old->prev;
-    int len = q_size(head);
-    while (len > 0) {
-        int num = rand() % len, cnt = 0;
-        while (cnt != num) {
-            old = old->next;
-            cnt += 1;
-        }
-        tmp = old->prev;
-        list_move(old, new);
-        list_move(new, tmp);
-        new = old->prev;
-        old = head->next;
-        len -= 1;
-    }
+    uint64_t key = 0;
+    int i = 0;
+
+    for (; i < 8 && s[i]; i++)
+        key = key << 8 | (unsigned char) s[i];
+    return i ? key << (8 * (8 - i)) : 0;
 }
 
-/* Implement list_sort from Linux kernel */
+/* Compare the nodes a and b, whose strings have the keys ka and kb from
+ * sort_key(), looking at the strings themselves only when the keys tie.
+ */
+static inline int sort_key_cmp(uint64_t ka,
+                               const struct list_head *a,
+                               uint64_t kb,
+                               const struct list_head *b)
+{
+    if (ka != kb)
+        return ka < kb ? -1 : 1;
+    /* Both strings end within the key, so they are equal */
+    if (!(ka & 0xff))
+        return 0;
+    return strcmp(list_entry(a, element_t, list)->value + 8,
+                  list_entry(b, element_t, list)->value + 8);
+}
 
-int cmp(const struct list_head *a, const struct list_head *b)
+static inline int sort_pair_cmp(const sort_pair_t *a,
+                                const sort_pair_t *b,
+                                bool descend)
 {
-    return strcmp(list_entry(a, element_t, list)->value,
-                  list_entry(b, element_t, list)->value);
+    int cmp = sort_key_cmp(a->key, a->node, b->key, b->node);
+    return descend ? -cmp : cmp;
 }
 
-struct list_head *merge(list_cmp_func_t cmp,
-                        struct list_head *a,
-                        struct list_head *b)
+/* Sort elements of queue in ascending/descending order through an array
+ *
+ * The nodes are gathered with their key prefixes into the first half of
+ * scratch, which is then sorted by a stable bottom-up merge sort that
+ * alternates between the two halves.  Most comparisons only look at the
+ * integer keys in contiguous memory, and the list is relinked once at the
+ * end.  If scratch is too small, q_sort() is used instead.
+ */
+void q_sort_array(struct list_head *head,
+                  bool descend,
+                  void *scratch,
+                  size_t size)
 {
-    struct list_head *head = NULL, **tail = &head;
+    if (!head || list_empty(head) || list_is_singular(head))
+        return;
 
-    for (;;) {
-        /* if equal, take 'a' -- important for stability */
-        if (cmp(a, b) <= 0) {
-            *tail = a;
-            tail = &a->next;
-            a = a->next;
-            if (!a) {
-                *tail = b;
-                break;
-            }
-        } else {
-            *tail = b;
-            tail = &b->next;
-            b = b->next;
-            if (!b) {
-                *tail = a;
-                break;
-            }
+    size_t n = q_size(head);
+    if (!scratch || size < q_sort_array_scratch(n)) {
+        q_sort(head, descend);
+        return;
+    }
+    if (!sort_begin(head, &descend))
+        return;
+
+    sort_pair_t *src = scratch, *dst = src + n;
+    size_t i = 0;
+    struct list_head *node;
+    list_for_each(node, head) {
+        src[i].key = sort_key(list_entry(node, element_t, list)->value);
+        src[i++].node = node;
+    }
+
+    for (size_t lo = 0; lo < n; lo += ARRAY_SORT_BLOCK) {
+        size_t hi = lo + ARRAY_SORT_BLOCK < n ? lo + ARRAY_SORT_BLOCK : n;
+        for (size_t j = lo + 1; j < hi; j++) {
+            sort_pair_t tmp = src[j];
+            size_t k = j;
+            for (; k > lo && sort_pair_cmp(&tmp, &src[k - 1], descend) < 0;
+                 k--)
+                src[k] = src[k - 1];
+            src[k] = tmp;
         }
     }
-    return head;
+
+    for (size_t width = ARRAY_SORT_BLOCK; width < n; width *= 2) {
+        for (size_t lo = 0; lo < n; lo += 2 * width) {
+            size_t mid = lo + width < n ? lo + width : n;
+            size_t hi = mid + width < n ? mid + width : n;
+            size_t a = lo, b = mid, k = lo;
+            while (a < mid && b < hi)
+                dst[k++] = sort_pair_cmp(&src[b], &src[a], descend) < 0
+                               ? src[b++]
+                               : src[a++];
+            while (a < mid)
+                dst[k++] = src[a++];
+            while (b < hi)
+                dst[k++] = src[b++];
+        }
+        sort_pair_t *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    struct list_head *prev = head;
+    for (i = 0; i < n; i++) {
+        prev->next = src[i].node;
+        src[i].node->prev = prev;
+        prev = src[i].node;
+    }
+    prev->next = head;
+    head->prev = prev;
+    sort_end(head, descend);
 }
 
-void merge_final(list_cmp_func_t cmp,
-                 struct list_head *head,
-                 struct list_head *a,
-                 struct list_head *b)
+/* Buckets of at most this many nodes are insertion sorted */
+#define RADIX_SMALL 16
+
+/* Stably insertion sort the null-terminated list of strings that all share
+ * their first depth bytes, returning the new first node and its last one
+ * through *last.
+ */
+static struct list_head *radix_insertion(struct list_head *list,
+                                         size_t depth,
+                                         struct list_head **last,
+                                         bool descend)
 {
-    struct list_head *tail = head;
-    uint8_t count = 0;
+    struct list_head *sorted = NULL;
 
-    for (;;) {
-        /* if equal, take 'a' -- important for sort stability */
-        if (cmp(a, b) <= 0) {
-            tail->next = a;
-            a->prev = tail;
-            tail = a;
-            a = a->next;
-            if (!a)
-                break;
-        } else {
-            tail->next = b;
-            b->prev = tail;
-            tail = b;
-            b = b->next;
-            if (!b) {
-                b = a;
+    while (list) {
+        struct list_head *node = list, **pos = &sorted;
+        const char *s = list_entry(node, element_t, list)->value + depth;
+        list = list->next;
+
+        /* Insert after any equal string, for stability */
+        for (; *pos; pos = &(*pos)->next) {
+            int cmp =
+                strcmp(s, list_entry(*pos, element_t, list)->value + depth);
+            if (descend ? cmp > 0 : cmp < 0)
                 break;
-            }
         }
+        node->next = *pos;
+        *pos = node;
     }
 
-    /* Finish linking remainder of list b on to tail */
-    tail->next = b;
-    do {
-        if (unlikely(!++count))
-            cmp(b, b);
+    for (*last = sorted; (*last)->next;)
+        *last = (*last)->next;
+    return sorted;
+}
+
+/* Stably sort the null-terminated list of n strings that all share their
+ * first depth bytes, returning the new first node and its last one through
+ * *last.
+ *
+ * The nodes are distributed into one bucket per byte value at offset depth,
+ * keeping their order, and the buckets are sorted one byte deeper.  Strings
+ * ending at depth land in bucket 0 and are all equal.  Only the buckets other
+ * than the largest are sorted by recursion, each holding at most half of the
+ * nodes, and the largest is handled by the next iteration, so the stack
+ * stays O(log n) deep however long the common prefixes are.
+ */
+static struct list_head *radix_list(struct list_head *list,
+                                    size_t n,
+                                    size_t depth,
+                                    struct list_head **last,
+                                    bool descend)
+{
+    /* Sorted nodes before and after the part still being sorted */
+    struct list_head *before = NULL, **before_tail = &before;
+    struct list_head *after = NULL, *after_last = NULL;
+
+    while (n > RADIX_SMALL) {
+        struct list_head *bucket[256], **tail[256];
+        size_t count[256] = {0};
+
+        for (; list; list = list->next) {
+            unsigned char c = list_entry(list, element_t, list)->value[depth];
+            if (!count[c]++)
+                tail[c] = &bucket[c];
+            *tail[c] = list;
+            tail[c] = &list->next;
+        }
+
+        /* Strings ending here, in bucket 0, are equal and already done */
+        int largest = 0;
+        for (int c = 1; c < 256; c++) {
+            if (count[c] && (!largest || count[c] > count[largest]))
+                largest = c;
+        }
+
+        struct list_head *piece = NULL, **piece_tail = &piece;
+        for (int i = 0; i < 256; i++) {
+            int c = descend ? 255 - i : i;
+            if (!count[c])
+                continue;
+            *tail[c] = NULL;
+            if (c && c == largest) {
+                /* Buckets done so far go before the largest one */
+                *before_tail = piece;
+                if (piece)
+                    before_tail = piece_tail;
+                piece = NULL;
+                piece_tail = &piece;
+                continue;
+            }
+            struct list_head *first = bucket[c],
+                             *end = container_of(tail[c], struct list_head,
+                                                 next);
+            if (c && count[c] > 1)
+                first = radix_list(first, count[c], depth + 1, &end, descend);
+            *piece_tail = first;
+            piece_tail = &end->next;
+        }
+
+        if (!largest) {
+            /* Nothing left to sort deeper */
+            *before_tail = piece;
+            if (piece)
+                before_tail = piece_tail;
+            list = NULL;
+            n = 0;
+            break;
+        }
+
+        /* The rest goes after the largest bucket, ahead of earlier rests */
+        if (piece) {
+            *piece_tail = after;
+            if (!after)
+                after_last = container_of(piece_tail, struct list_head, next);
+            after = piece;
+        }
+
+        list = bucket[largest];
+        n = count[largest];
+        depth++;
+    }
+
+    struct list_head *end = NULL;
+    if (n > 1)
+        list = radix_insertion(list, depth, &end, descend);
+    else
+        end = list;
+
+    *before_tail = list;
+    if (list)
+        before_tail = &end->next;
+    *before_tail = after;
+    if (after)
+        *last = after_last;
+    else
+        *last = container_of(before_tail, struct list_head, next);
+    return before;
+}
+
+/* Sort elements of queue in ascending/descending order by MSD radix sort
+ *
+ * Stable like q_sort(), but the strings are never compared as a whole except
+ * inside small buckets, see radix_list().  This function does not allocate.
+ */
+void q_sort_radix(struct list_head *head, bool descend)
+{
+    if (!head || list_empty(head) || list_is_singular(head) ||
+        !sort_begin(head, &descend))
+        return;
+
+    struct list_head *last;
+    head->prev->next = NULL;
+    struct list_head *list =
+        radix_list(head->next, q_size(head), 0, &last, descend);
+
+    /* Rebuild the prev links of the circular doubly-linked list */
+    struct list_head *prev = head;
+    head->next = list;
+    for (; list; list = list->next) {
+        list->prev = prev;
+        prev = list;
+    }
+    prev->next = head;
+    head->prev = prev;
+    sort_end(head, descend);
+}
+
+/* Scan from the tail towards the head, keeping the smallest (or, when
+ * descend is set, the largest) value seen so far on the right side.  A node
+ * is deleted exactly when it compares strictly greater (or less) than that
+ * bound, so a single pass suffices.
+ */
+static int q_monotonic(struct list_head *head, bool descend)
+{
+    if (!head || list_empty(head))
+        return 0;
+
+    q_straighten(head);
+
+    const char *bound = list_last_entry(head, element_t, list)->value;
+    struct list_head *cur = head->prev->prev, *prev;
+    for (; cur != head; cur = prev) {
+        prev = cur->prev;
+        element_t *ele = list_entry(cur, element_t, list);
+        int cmp = strcmp(ele->value, bound);
+        if (descend ? cmp < 0 : cmp > 0) {
+            list_del(cur);
+            q_release_element(ele);
+            q_head(head)->size--;
+        } else {
+            bound = ele->value;
+        }
+    }
+
+    /* What is left is sorted */
+    q_head(head)->order = descend ? -1 : 1;
+    return q_size(head);
+}
+
+/* Remove every node which has a node with a strictly less value anywhere to
+ * the right side of it */
+int q_ascend(struct list_head *head)
+{
+    return q_monotonic(head, false);
+}
+
+/* Remove every node which has a node with a strictly greater value anywhere to
+ * the right side of it */
+int q_descend(struct list_head *head)
+{
+    return q_monotonic(head, true);
+}
+
+int q_merge_mode = 0;
+void (*q_merge_round)(int round, int from, int to) = NULL;
+
+/* Queues q_merge() merges at once through its on-stack arrays */
+#define MERGE_MAX 1024
+
+/* Entry of the heap of merge_heap() */
+typedef struct {
+    struct list_head *node; /* Next node of a queue, null-terminated */
+    uint64_t key;           /* sort_key() of the string of node */
+    int order;              /* Position of the queue, breaking ties */
+} merge_entry_t;
+
+static inline bool merge_before(const merge_entry_t *x,
+                                const merge_entry_t *y,
+                                bool descend)
+{
+    int cmp = sort_key_cmp(x->key, x->node, y->key, y->node);
+    if (descend)
+        cmp = -cmp;
+    return cmp < 0 || (!cmp && x->order < y->order);
+}
+
+static inline void merge_load(merge_entry_t *entry, struct list_head *node)
+{
+    entry->node = node;
+    entry->key = sort_key(list_entry(node, element_t, list)->value);
+}
+
+/* Move heap[i] down below the entries that come before it */
+static void merge_sift(merge_entry_t *heap, int n, int i, bool descend)
+{
+    merge_entry_t entry = heap[i];
+
+    for (int child; (child = 2 * i + 1) < n; i = child) {
+        if (child + 1 < n &&
+            merge_before(&heap[child + 1], &heap[child], descend))
+            child++;
+        if (!merge_before(&heap[child], &entry, descend))
+            break;
+        heap[i] = heap[child];
+    }
+    heap[i] = entry;
+}
+
+/* Close the null-terminated list into the circular list of head behind
+ * tail, restoring the prev links on the way.
+ */
+static void merge_link(struct list_head *head,
+                       struct list_head *tail,
+                       struct list_head *list)
+{
+    for (; list; list = list->next)
+        tail = sort_append(head, tail, list, list);
+    tail->next = head;
+    head->prev = tail;
+}
+
+/* Merge the n sorted null-terminated lists in list in a single pass, always
+ * taking the next node from the top of a binary heap ordered by string and
+ * then by position in list, so the merge is stable.  The heap entries carry
+ * the key prefixes of their strings, so sifting rarely leaves the heap
+ * itself.  Once one list is left, it is appended whole.
+ *
+ * With head set, the result is linked into the circular list behind head;
+ * otherwise it is returned null-terminated.
+ */
+static struct list_head *merge_heap(struct list_head *head,
+                                    struct list_head **list,
+                                    int n,
+                                    bool descend)
+{
+    merge_entry_t heap[MERGE_MAX];
+    struct list_head dummy, *tail = head ? head : &dummy;
+
+    /* Loaded below before it is read, but -O2 cannot tell and warns */
+    heap[0].node = NULL;
+    for (int i = 0; i < n; i++) {
+        merge_load(&heap[i], list[i]);
+        heap[i].order = i;
+    }
+    for (int i = n / 2 - 1; i >= 0; i--)
+        merge_sift(heap, n, i, descend);
+    while (n > 1) {
+        struct list_head *node = heap[0].node;
+        tail = sort_append(head, tail, node, node);
+        if (node->next)
+            merge_load(&heap[0], node->next);
+        else
+            heap[0] = heap[--n];
+        merge_sift(heap, n, 0, descend);
+    }
+
+    struct list_head *rest = n ? heap[0].node : NULL;
+    if (!head) {
+        tail->next = rest;
+        return dummy.next;
+    }
+    merge_link(head, tail, rest);
+    return head->next;
+}
+
+/* Merge the n sorted null-terminated lists in list in rounds: each round
+ * merges lists 0 and 1, 2 and 3, and so on by sort_merge(), so every node
+ * is moved about log2(n) times and the merge is stable.  The pairs of a
+ * round are independent and are merged threads at a time by sort_tasks().
+ * q_merge_round is told about each round once it is over.
+ *
+ * head is as for merge_heap().
+ */
+static struct list_head *merge_pairwise(struct list_head *head,
+                                        struct list_head **list,
+                                        int n,
+                                        bool descend,
+                                        int threads)
+{
+    sort_task_t task[SORT_MAX_THREADS];
+    bool linked = false;
+
+    for (int round = 1; n > 1; round++) {
+        int pairs = n / 2;
+        if (head && n == 2) {
+            sort_merge(head, list[0], list[1], descend);
+            linked = true;
+        } else {
+            for (int i = 0; i < pairs; i += threads) {
+                int tasks = pairs - i < threads ? pairs - i : threads;
+                for (int j = 0; j < tasks; j++) {
+                    task[j] = (sort_task_t){.a = list[2 * (i + j)],
+                                            .b = list[2 * (i + j) + 1],
+                                            .descend = descend};
+                }
+                sort_tasks(task, tasks);
+                for (int j = 0; j < tasks; j++)
+                    list[i + j] = task[j].a;
+            }
+            if (n & 1)
+                list[pairs] = list[n - 1];
+        }
+        if (q_merge_round)
+            q_merge_round(round, n, pairs + (n & 1));
+        n = pairs + (n & 1);
+    }
+
+    if (!head)
+        return n ? list[0] : NULL;
+    if (!linked)
+        merge_link(head, head, n ? list[0] : NULL);
+    return head->next;
+}
+
+/* Merge all the queues into one sorted queue, which is in ascending/descending
+ * order
+ *
+ * All the queues are merged into the first one, by merge_heap() in one
+ * O(N log Q) pass, or by merge_pairwise() with q_merge_mode set.  Beyond
+ * MERGE_MAX non-empty queues, the ones gathered so far are merged into a
+ * single list that takes the first place, so the stack use stays fixed.
+ * Every queue but the first is left empty, and the sizes of all of them and
+ * of their contexts are updated.
+ */
+int q_merge(struct list_head *head, bool descend)
+{
+    if (!head || list_empty(head))
+        return 0;
+
+    queue_contex_t *first = list_first_entry(head, queue_contex_t, chain);
+    if (list_is_singular(head))
+        return first->size = q_size(first->q);
+
+    int total = 0;
+    queue_contex_t *ctx;
+    list_for_each_entry(ctx, head, chain)
+        total += q_size(ctx->q);
+
+    int threads = q_threads < SORT_MAX_THREADS ? q_threads : SORT_MAX_THREADS;
+    if (threads > total / SORT_MIN_PER_THREAD)
+        threads = total / SORT_MIN_PER_THREAD;
+    if (threads < 1)
+        threads = 1;
+
+    struct list_head *list[MERGE_MAX];
+    int n = 0;
+    list_for_each_entry(ctx, head, chain) {
+        q_straighten(ctx->q);
+        if (!list_empty(ctx->q)) {
+            if (n == MERGE_MAX) {
+                list[0] = q_merge_mode
+                              ? merge_pairwise(NULL, list, n, descend, threads)
+                              : merge_heap(NULL, list, n, descend);
+                n = 1;
+            }
+            ctx->q->prev->next = NULL;
+            list[n++] = ctx->q->next;
+            INIT_LIST_HEAD(ctx->q);
+        }
+        q_head(ctx->q)->size = 0;
+        q_head(ctx->q)->order = 0;
+        ctx->size = 0;
+    }
+
+    if (q_merge_mode)
+        merge_pairwise(first->q, list, n, descend, threads);
+    else
+        merge_heap(first->q, list, n, descend);
+    /* The queues are not checked to be sorted, so neither is the result */
+    q_head(first->q)->size = total;
+    q_head(first->q)->order = 0;
+    first->size = total;
+    return total;
+}
+
+/* Number of nodes shuffled at once through an on-stack pointer array */
+#define SHUFFLE_CHUNK 4096
+
+/* Next output of a splitmix generator: a Weyl sequence fed through the
+ * finalizer in random.h.
+ */
+static inline uintptr_t shuffle_next(uintptr_t *state)
+{
+#if M_INTPTR_SIZE == 8
+    *state += 0x9e3779b97f4a7c15UL;
+#else
+    *state += 0x9e3779b9UL;
+#endif
+    return random_shuffle(*state);
+}
+
+/* Map the next output onto [0, n) with a multiply-shift instead of a
+ * division, see https://lemire.me/blog/2016/06/27/
+ */
+static inline size_t shuffle_below(uintptr_t *state, size_t n)
+{
+#if M_INTPTR_SIZE == 8
+    return (size_t) (((__uint128_t) shuffle_next(state) * n) >> 64);
+#else
+    return (size_t) (((uint64_t) shuffle_next(state) * n) >> 32);
+#endif
+}
+
+/* Fisher-Yates shuffle of the null-terminated list of n <= SHUFFLE_CHUNK
+ * nodes, returning the new first node and its last one through *last.
+ */
+static struct list_head *shuffle_chunk(struct list_head *list,
+                                       size_t n,
+                                       struct list_head **last,
+                                       uintptr_t *state)
+{
+    struct list_head *chunk[SHUFFLE_CHUNK];
+
+    for (size_t i = 0; i < n; list = list->next)
+        chunk[i++] = list;
+
+    for (size_t i = n - 1; i > 0; i--) {
+        size_t j = shuffle_below(state, i + 1);
+        struct list_head *tmp = chunk[i];
+        chunk[i] = chunk[j];
+        chunk[j] = tmp;
+    }
+    for (size_t i = 0; i + 1 < n; i++)
+        chunk[i]->next = chunk[i + 1];
+    chunk[n - 1]->next = NULL;
+
+    *last = chunk[n - 1];
+    return chunk[0];
+}
+
+/* Number of buckets a list too long for shuffle_chunk() is scattered into */
+#define SHUFFLE_BUCKETS 64
+
+/* Shuffle the null-terminated list of n nodes, returning the new first node
+ * and its last one through *last.
+ *
+ * Long lists are scattered into SHUFFLE_BUCKETS buckets by random draws, each
+ * bucket is shuffled recursively and the buckets are concatenated.  As every
+ * node picks its bucket independently and uniformly, every permutation stays
+ * equally likely (Rao-Sandelius), while each pass walks the list in order.
+ */
+static struct list_head *shuffle_list(struct list_head *list,
+                                      size_t n,
+                                      struct list_head **last,
+                                      uintptr_t *state)
+{
+    if (n <= SHUFFLE_CHUNK)
+        return shuffle_chunk(list, n, last, state);
+
+    struct list_head *bucket[SHUFFLE_BUCKETS];
+    struct list_head **tail[SHUFFLE_BUCKETS];
+    size_t count[SHUFFLE_BUCKETS] = {0};
+
+    for (int i = 0; i < SHUFFLE_BUCKETS; i++)
+        tail[i] = &bucket[i];
+    for (; list; list = list->next) {
+        size_t i = shuffle_below(state, SHUFFLE_BUCKETS);
+        *tail[i] = list;
+        tail[i] = &list->next;
+        count[i]++;
+    }
+
+    struct list_head *head = NULL, **link = &head;
+    for (int i = 0; i < SHUFFLE_BUCKETS; i++) {
+        if (!count[i])
+            continue;
+        *tail[i] = NULL;
+        *link = shuffle_list(bucket[i], count[i], last, state);
+        link = &(*last)->next;
+    }
+
+    return head;
+}
+
+/* Shuffle elements in queue.
+ *
+ * Allocation is not allowed here, so there is no pointer array for the whole
+ * queue: shuffle_list() splits it into random buckets that fit in an on-stack
+ * array of SHUFFLE_CHUNK nodes and runs Fisher-Yates on each.  This takes
+ * O(n log(n / SHUFFLE_CHUNK) / log(SHUFFLE_BUCKETS)) time, a couple of
+ * sequential passes for any queue that fits in memory.  The generator state
+ * is the caller's and carries over from one shuffle to the next.
+ */
+void q_shuffle(struct list_head *head, uintptr_t *state)
+{
+    if (!head || list_empty(head) || list_is_singular(head))
+        return;
+
+    struct list_head *last;
+
+    q_straighten(head);
+    q_head(head)->order = 0;
+    head->prev->next = NULL;
+    struct list_head *list =
+        shuffle_list(head->next, q_size(head), &last, state);
+
+    /* Rebuild the prev links of the circular doubly-linked list */
+    struct list_head *prev = head;
+    head->next = list;
+    for (; list; list = list->next) {
+        list->prev = prev;
+        prev = list;
+    }
+    prev->next = head;
+    head->prev = prev;
+}
+
+/* Implement list_sort from Linux kernel */
+
+int cmp(const struct list_head *a, const struct list_head *b)
+{
+    return strcmp(list_entry(a, element_t, list)->value,
+                  list_entry(b, element_t, list)->value);
+}
+
+struct list_head *merge(list_cmp_func_t cmp,
+                        struct list_head *a,
+                        struct list_head *b)
+{
+    struct list_head *head = NULL, **tail = &head;
+
+    for (;;) {
+        /* if equal, take 'a' -- important for stability */
+        if (cmp(a, b) <= 0) {
+            *tail = a;
+            tail = &a->next;
+            a = a->next;
+            if (!a) {
+                *tail = b;
+                break;
+            }
+        } else {
+            *tail = b;
+            tail = &b->next;
+            b = b->next;
+            if (!b) {
+                *tail = a;
+                break;
+            }
+        }
+    }
+    return head;
+}
+
+void merge_final(list_cmp_func_t cmp,
+                 struct list_head *head,
+                 struct list_head *a,
+                 struct list_head *b)
+{
+    struct list_head *tail = head;
+    uint8_t count = 0;
+
+    for (;;) {
+        /* if equal, take 'a' -- important for sort stability */
+        if (cmp(a, b) <= 0) {
+            tail->next = a;
+            a->prev = tail;
+            tail = a;
+            a = a->next;
+            if (!a)
+                break;
+        } else {
+            tail->next = b;
+            b->prev = tail;
+            tail = b;
+            b = b->next;
+            if (!b) {
+                b = a;
+                break;
+            }
+        }
+    }
+
+    /* Finish linking remainder of list b on to tail */
+    tail->next = b;
+    do {
+        if (unlikely(!++count))
+            cmp(b, b);
+        b->prev = tail;
+        tail = b;
+        b = b->next;
+    } while (b);
+
+    /* And the final links to make a circular doubly-linked list */
+    tail->next = head;
+    head->prev = tail;
+}
+
+int list_sort_branchless = 0;
+
+/* Same as merge(), but the node to take is picked by indexing with the
+ * comparison result rather than by branching on it, which random input
+ * mispredicts about half of the time.  Only the end of either list is a
+ * conditional jump, and it is rarely taken.
+ *
+ * The index t is 1 only if the node of b compares strictly below that of a,
+ * so ties take the node of a and the merge stays stable.
+ *
+ * Without a predicted branch the processor no longer starts on the next node
+ * before the comparison is done, so the successors of both candidates are
+ * prefetched instead.
+ */
+struct list_head *merge_branchless(list_cmp_func_t cmp,
+                                   struct list_head *a,
+                                   struct list_head *b)
+{
+    struct list_head *head = NULL, **tail = &head;
+    struct list_head *side[2] = {a, b};
+
+    for (;;) {
+        __builtin_prefetch(side[0]->next);
+        __builtin_prefetch(side[1]->next);
+        int t = cmp(side[0], side[1]) > 0;
+        struct list_head *node = side[t];
+        *tail = node;
+        tail = &node->next;
+        side[t] = node->next;
+        if (!side[t])
+            break;
+    }
+    *tail = side[0] ? side[0] : side[1];
+    return head;
+}
+
+/* Same as merge_final(), picking nodes like merge_branchless() */
+void merge_final_branchless(list_cmp_func_t cmp,
+                            struct list_head *head,
+                            struct list_head *a,
+                            struct list_head *b)
+{
+    struct list_head *tail = head;
+    struct list_head *side[2] = {a, b};
+    uint8_t count = 0;
+
+    for (;;) {
+        __builtin_prefetch(side[0]->next);
+        __builtin_prefetch(side[1]->next);
+        int t = cmp(side[0], side[1]) > 0;
+        struct list_head *node = side[t];
+        tail->next = node;
+        node->prev = tail;
+        tail = node;
+        side[t] = node->next;
+        if (!side[t])
+            break;
+    }
+
+    /* Finish linking remainder of the other list on to tail */
+    b = side[0] ? side[0] : side[1];
+    tail->next = b;
+    do {
+        if (unlikely(!++count))
+            cmp(b, b);
         b->prev = tail;
         tail = b;
         b = b->next;
@@ -480,7 +1744,8 @@ void list_sort(struct list_head *head, list_cmp_func_t cmp, bool descend)
         if (likely(bits)) {
             struct list_head *a = *tail, *b = a->prev;
 
-            a = merge(cmp, b, a);
+            a = list_sort_branchless ? merge_branchless(cmp, b, a)
+                                     : merge(cmp, b, a);
             /* Install the merged result in place of the inputs */
             a->prev = b->prev;
             *tail = a;
@@ -502,10 +1767,679 @@ void list_sort(struct list_head *head, list_cmp_func_t cmp, bool descend)
 
         if (!next)
             break;
-        list = merge(cmp, pending, list);
+        list = list_sort_branchless ? merge_branchless(cmp, pending, list)
+                                    : merge(cmp, pending, list);
         pending = next;
     }
 
     /* The final merge, rebuilding prev links */
-    merge_final(cmp, head, pending, list);
+    if (list_sort_branchless)
+        merge_final_branchless(cmp, head, pending, list);
+    else
+        merge_final(cmp, head, pending, list);
+}
+
+/* Stand-in for a node while list_sort_keyed() runs, keeping the key of its
+ * string next to the links that list_sort() walks.
+ */
+typedef struct {
+    struct list_head list;
+    uint64_t key;
+    struct list_head *node;
+} sort_shadow_t;
+
+static int cmp_keyed(const struct list_head *a, const struct list_head *b)
+{
+    const sort_shadow_t *sa = list_entry(a, sort_shadow_t, list),
+                        *sb = list_entry(b, sort_shadow_t, list);
+    return sort_key_cmp(sa->key, sa->node, sb->key, sb->node);
+}
+
+static int cmp_keyed_descend(const struct list_head *a,
+                             const struct list_head *b)
+{
+    return cmp_keyed(b, a);
+}
+
+/* cmp() the other way round, which list_sort() keeps stable: equal nodes
+ * still compare as in order
+ */
+static int cmp_descend(const struct list_head *a, const struct list_head *b)
+{
+    return cmp(b, a);
+}
+
+size_t list_sort_keyed_scratch(size_t n)
+{
+    return n * sizeof(sort_shadow_t);
+}
+
+/* Sort with list_sort() over shadows of the nodes laid out in scratch, so
+ * that merge() and merge_final() mostly compare keys in contiguous memory
+ * instead of following two pointers per string.  The nodes are relinked in
+ * the order of their shadows afterwards.
+ */
+void list_sort_keyed(struct list_head *head,
+                     bool descend,
+                     void *scratch,
+                     size_t size)
+{
+    if (!head || list_empty(head) || list_is_singular(head))
+        return;
+
+    /* list_sort() only sorts the links, so they have to be in order */
+    q_straighten(head);
+    q_head(head)->order = 0;
+    size_t n = q_size(head);
+    if (!scratch || size < list_sort_keyed_scratch(n)) {
+        list_sort(head, descend ? cmp_descend : cmp, descend);
+        return;
+    }
+
+    sort_shadow_t *shadow = scratch;
+    LIST_HEAD(shadows);
+    struct list_head *node;
+    list_for_each(node, head) {
+        shadow->key = sort_key(list_entry(node, element_t, list)->value);
+        shadow->node = node;
+        list_add_tail(&shadow++->list, &shadows);
+    }
+
+    list_sort(&shadows, descend ? cmp_keyed_descend : cmp_keyed, descend);
+
+    struct list_head *prev = head;
+    list_for_each(node, &shadows) {
+        struct list_head *cur = list_entry(node, sort_shadow_t, list)->node;
+        prev->next = cur;
+        cur->prev = prev;
+        prev = cur;
+    }
+    prev->next = head;
+    head->prev = prev;
+}
+
+/* Slots a ring buffer starts with */
+#define RING_MIN 8
+
+/* Queue of strings kept in a circular array whose capacity is a power of
+ * two.  The strings are copies owned by the ring.
+ */
+struct ring {
+    char **slot;
+    size_t cap;   /* Number of slots, a power of two */
+    size_t first; /* Slot of the head */
+    size_t size;
+};
+
+static inline char **ring_slot(const ring_t *r, size_t i)
+{
+    return &r->slot[(r->first + i) & (r->cap - 1)];
+}
+
+ring_t *q_ring_new(void)
+{
+    ring_t *r = malloc(sizeof(ring_t));
+    if (!r)
+        return NULL;
+    /* The first slots are allocated up front, so that inserting into an
+     * empty ring costs the same as into any other ring with room left.
+     */
+    r->slot = malloc(RING_MIN * sizeof(char *));
+    if (!r->slot) {
+        free(r);
+        return NULL;
+    }
+    r->cap = RING_MIN;
+    r->first = 0;
+    r->size = 0;
+    return r;
+}
+
+void q_ring_free(ring_t *r)
+{
+    if (!r)
+        return;
+    for (size_t i = 0; i < r->size; i++)
+        free(*ring_slot(r, i));
+    free(r->slot);
+    free(r);
+}
+
+/* Make room for one more string, doubling the capacity when full */
+static bool ring_reserve(ring_t *r)
+{
+    if (r->size < r->cap)
+        return true;
+
+    char **slot = malloc(2 * r->cap * sizeof(char *));
+    if (!slot)
+        return false;
+    for (size_t i = 0; i < r->size; i++)
+        slot[i] = *ring_slot(r, i);
+    free(r->slot);
+    r->slot = slot;
+    r->cap *= 2;
+    r->first = 0;
+    return true;
+}
+
+/* Insert a copy of s at the head or the tail of the ring */
+static bool ring_insert(ring_t *r, const char *s, bool at_head)
+{
+    if (!r || !s || !ring_reserve(r))
+        return false;
+
+    size_t len = strlen(s);
+    char *copy = malloc(len + 1);
+    if (!copy)
+        return false;
+    memcpy(copy, s, len + 1);
+
+    if (at_head) {
+        r->first = (r->first - 1) & (r->cap - 1);
+        r->slot[r->first] = copy;
+    } else {
+        *ring_slot(r, r->size) = copy;
+    }
+    r->size++;
+    return true;
+}
+
+bool q_ring_insert_head(ring_t *r, const char *s)
+{
+    return ring_insert(r, s, true);
+}
+
+bool q_ring_insert_tail(ring_t *r, const char *s)
+{
+    return ring_insert(r, s, false);
+}
+
+/* Remove the string at the head or the tail of the ring, copying it to sp
+ * like q_remove_head() does.
+ */
+static bool ring_remove(ring_t *r, char *sp, size_t bufsize, bool at_head)
+{
+    if (!r || !r->size)
+        return false;
+
+    char **slot = ring_slot(r, at_head ? 0 : r->size - 1);
+    if (sp && bufsize)
+        q_copy_string(sp, *slot, strnlen(*slot, bufsize - 1), bufsize);
+    free(*slot);
+    if (at_head)
+        r->first = (r->first + 1) & (r->cap - 1);
+    r->size--;
+    return true;
+}
+
+bool q_ring_remove_head(ring_t *r, char *sp, size_t bufsize)
+{
+    return ring_remove(r, sp, bufsize, true);
+}
+
+bool q_ring_remove_tail(ring_t *r, char *sp, size_t bufsize)
+{
+    return ring_remove(r, sp, bufsize, false);
+}
+
+int q_ring_size(const ring_t *r)
+{
+    return r ? (int) r->size : 0;
+}
+
+const char *q_ring_at(const ring_t *r, int i)
+{
+    if (!r || i < 0 || (size_t) i >= r->size)
+        return NULL;
+    return *ring_slot(r, i);
+}
+
+void q_ring_reverse(ring_t *r)
+{
+    if (!r)
+        return;
+    for (size_t i = 0, j = r->size - 1; i < j && j < r->size; i++, j--) {
+        char **a = ring_slot(r, i), **b = ring_slot(r, j);
+        char *tmp = *a;
+        *a = *b;
+        *b = tmp;
+    }
+}
+
+void q_ring_swap(ring_t *r)
+{
+    if (!r)
+        return;
+    for (size_t i = 0; i + 1 < r->size; i += 2) {
+        char **a = ring_slot(r, i), **b = ring_slot(r, i + 1);
+        char *tmp = *a;
+        *a = *b;
+        *b = tmp;
+    }
+}
+
+size_t q_ring_sort_scratch(size_t n)
+{
+    return n * sizeof(char *);
+}
+
+static void ring_flip(char **slot, size_t lo, size_t hi)
+{
+    for (; lo + 1 < hi; lo++, hi--) {
+        char *tmp = slot[lo];
+        slot[lo] = slot[hi - 1];
+        slot[hi - 1] = tmp;
+    }
+}
+
+static inline int ring_cmp(const char *a, const char *b, bool descend)
+{
+    int cmp = strcmp(a, b);
+    return descend ? -cmp : cmp;
+}
+
+/* Stably sort the n strings of a: insertion sort blocks of 16 of them, then
+ * merge the blocks bottom-up, alternating between a and tmp.  Without tmp,
+ * the whole array is insertion sorted, which is stable too but quadratic.
+ */
+static void strings_sort(char **a, size_t n, bool descend, char **tmp)
+{
+    size_t block = tmp ? 16 : n;
+    char **src = a, **dst = tmp;
+    for (size_t lo = 0; lo < n; lo += block) {
+        size_t hi = lo + block < n ? lo + block : n;
+        for (size_t j = lo + 1; j < hi; j++) {
+            char *s = src[j];
+            size_t k = j;
+            for (; k > lo && ring_cmp(s, src[k - 1], descend) < 0; k--)
+                src[k] = src[k - 1];
+            src[k] = s;
+        }
+    }
+
+    for (size_t width = block; width < n; width *= 2) {
+        for (size_t lo = 0; lo < n; lo += 2 * width) {
+            size_t mid = lo + width < n ? lo + width : n;
+            size_t hi = mid + width < n ? mid + width : n;
+            size_t i = lo, j = mid, k = lo;
+            while (i < mid && j < hi)
+                dst[k++] = ring_cmp(src[j], src[i], descend) < 0 ? src[j++]
+                                                                 : src[i++];
+            while (i < mid)
+                dst[k++] = src[i++];
+            while (j < hi)
+                dst[k++] = src[j++];
+        }
+        char **swap = src;
+        src = dst;
+        dst = swap;
+    }
+    if (src != a)
+        memcpy(a, src, n * sizeof(char *));
+}
+
+/* Sort the strings of the ring in ascending/descending order
+ *
+ * The slots are first rotated in place so that the strings start at slot 0,
+ * then sorted by strings_sort(), through scratch if it is large enough.
+ * This function does not allocate.
+ */
+void q_ring_sort(ring_t *r, bool descend, void *scratch, size_t size)
+{
+    if (!r || r->size < 2)
+        return;
+
+    if (r->first) {
+        ring_flip(r->slot, 0, r->first);
+        ring_flip(r->slot, r->first, r->cap);
+        ring_flip(r->slot, 0, r->cap);
+        r->first = 0;
+    }
+
+    bool fits = scratch && size >= q_ring_sort_scratch(r->size);
+    strings_sort(r->slot, r->size, descend, fits ? scratch : NULL);
+}
+
+/* Strings a chunk of a chunked queue holds */
+#define CHUNK_SLOTS 30
+
+/* Chunk of a chunked queue: its strings are str[lo..hi), and it is never
+ * empty.  Chunks fill up towards the end of the queue they grow from, so
+ * only the first and the last one have room left in the middle of a run of
+ * insertions.
+ */
+struct chunk {
+    struct list_head link;
+    unsigned lo, hi;
+    char *str[CHUNK_SLOTS];
+};
+
+/* Queue of strings in an unrolled linked list of chunks.  The strings are
+ * copies owned by the queue.  cur caches the chunk last looked up by
+ * chunked_slot(), whose first string is at position cur_first.
+ */
+struct chunked {
+    struct list_head chunks;
+    size_t size;
+    struct chunk *cur;
+    size_t cur_first;
+};
+
+static inline size_t chunk_count(const struct chunk *k)
+{
+    return k->hi - k->lo;
+}
+
+chunked_t *q_chunked_new(void)
+{
+    chunked_t *c = malloc(sizeof(chunked_t));
+    if (!c)
+        return NULL;
+    INIT_LIST_HEAD(&c->chunks);
+    c->size = 0;
+    c->cur = NULL;
+    return c;
+}
+
+void q_chunked_free(chunked_t *c)
+{
+    if (!c)
+        return;
+    struct chunk *k, *safe;
+    list_for_each_entry_safe(k, safe, &c->chunks, link) {
+        for (unsigned i = k->lo; i < k->hi; i++)
+            free(k->str[i]);
+        free(k);
+    }
+    free(c);
+}
+
+/* Slot of the string at position i < c->size.  The walk starts from
+ * whichever of the cached chunk and the two ends is nearest, so looking up
+ * positions in order, or close to either end, takes O(1) time.
+ */
+static char **chunked_slot(chunked_t *c, size_t i)
+{
+    struct chunk *k = list_first_entry(&c->chunks, struct chunk, link);
+    size_t first = 0, dist = i;
+    if (c->size - i < dist) {
+        k = list_last_entry(&c->chunks, struct chunk, link);
+        first = c->size - chunk_count(k);
+        dist = c->size - i;
+    }
+    if (c->cur) {
+        size_t d = i < c->cur_first ? c->cur_first - i : i - c->cur_first;
+        if (d < dist) {
+            k = c->cur;
+            first = c->cur_first;
+        }
+    }
+
+    while (i < first) {
+        k = list_entry(k->link.prev, struct chunk, link);
+        first -= chunk_count(k);
+    }
+    while (i >= first + chunk_count(k)) {
+        first += chunk_count(k);
+        k = list_entry(k->link.next, struct chunk, link);
+    }
+    c->cur = k;
+    c->cur_first = first;
+    return &k->str[k->lo + (i - first)];
+}
+
+/* Insert a copy of s at the head or the tail of the queue, starting a new
+ * chunk when the one at that end is full
+ */
+static bool chunked_insert(chunked_t *c, const char *s, bool at_head)
+{
+    if (!c || !s)
+        return false;
+
+    size_t len = strlen(s);
+    char *copy = malloc(len + 1);
+    if (!copy)
+        return false;
+    memcpy(copy, s, len + 1);
+
+    struct chunk *k = NULL;
+    if (!list_empty(&c->chunks)) {
+        k = at_head ? list_first_entry(&c->chunks, struct chunk, link)
+                    : list_last_entry(&c->chunks, struct chunk, link);
+        if (at_head ? !k->lo : k->hi == CHUNK_SLOTS)
+            k = NULL;
+    }
+    if (!k) {
+        k = malloc(sizeof(struct chunk));
+        if (!k) {
+            free(copy);
+            return false;
+        }
+        k->lo = k->hi = at_head ? CHUNK_SLOTS : 0;
+        if (at_head)
+            list_add(&k->link, &c->chunks);
+        else
+            list_add_tail(&k->link, &c->chunks);
+    }
+
+    if (at_head)
+        k->str[--k->lo] = copy;
+    else
+        k->str[k->hi++] = copy;
+    c->size++;
+    c->cur = NULL;
+    return true;
+}
+
+bool q_chunked_insert_head(chunked_t *c, const char *s)
+{
+    return chunked_insert(c, s, true);
+}
+
+bool q_chunked_insert_tail(chunked_t *c, const char *s)
+{
+    return chunked_insert(c, s, false);
+}
+
+/* Remove the string at the head or the tail of the queue, copying it to sp
+ * like q_remove_head() does, and free its chunk once empty
+ */
+static bool chunked_remove(chunked_t *c, char *sp, size_t bufsize, bool at_head)
+{
+    if (!c || !c->size)
+        return false;
+
+    struct chunk *k = at_head
+                          ? list_first_entry(&c->chunks, struct chunk, link)
+                          : list_last_entry(&c->chunks, struct chunk, link);
+    char *s = at_head ? k->str[k->lo++] : k->str[--k->hi];
+    if (sp && bufsize)
+        q_copy_string(sp, s, strnlen(s, bufsize - 1), bufsize);
+    free(s);
+    if (k->lo == k->hi) {
+        list_del(&k->link);
+        free(k);
+    }
+    c->size--;
+    c->cur = NULL;
+    return true;
+}
+
+bool q_chunked_remove_head(chunked_t *c, char *sp, size_t bufsize)
+{
+    return chunked_remove(c, sp, bufsize, true);
+}
+
+bool q_chunked_remove_tail(chunked_t *c, char *sp, size_t bufsize)
+{
+    return chunked_remove(c, sp, bufsize, false);
+}
+
+int q_chunked_size(const chunked_t *c)
+{
+    return c ? (int) c->size : 0;
+}
+
+const char *q_chunked_at(chunked_t *c, int i)
+{
+    if (!c || i < 0 || (size_t) i >= c->size)
+        return NULL;
+    return *chunked_slot(c, i);
+}
+
+/* Reverse the order of the chunks, and mirror each of them so that the room
+ * left at either end of the queue stays at that end
+ */
+void q_chunked_reverse(chunked_t *c)
+{
+    if (!c)
+        return;
+
+    struct list_head *node, *safe;
+    list_for_each_safe(node, safe, &c->chunks) {
+        struct chunk *k = list_entry(node, struct chunk, link);
+        for (unsigned i = 0, j = CHUNK_SLOTS - 1; i < j; i++, j--) {
+            char *tmp = k->str[i];
+            k->str[i] = k->str[j];
+            k->str[j] = tmp;
+        }
+        unsigned lo = k->lo;
+        k->lo = CHUNK_SLOTS - k->hi;
+        k->hi = CHUNK_SLOTS - lo;
+        list_move(node, &c->chunks);
+    }
+    c->cur = NULL;
+}
+
+size_t q_chunked_sort_scratch(size_t n)
+{
+    return 2 * n * sizeof(char *);
+}
+
+/* Sort the strings of the queue in ascending/descending order
+ *
+ * The string pointers are gathered into scratch, sorted there by
+ * strings_sort() and put back in the same slots, so the chunks keep their
+ * layout.  Without enough scratch, the queue is insertion sorted in place,
+ * which is stable too but quadratic.  This function does not allocate.
+ */
+void q_chunked_sort(chunked_t *c, bool descend, void *scratch, size_t size)
+{
+    if (!c || c->size < 2)
+        return;
+
+    size_t n = c->size;
+    struct chunk *k;
+    if (!scratch || size < q_chunked_sort_scratch(n)) {
+        for (size_t j = 1; j < n; j++) {
+            char *s = *chunked_slot(c, j);
+            size_t i = j;
+            for (; i > 0 && ring_cmp(s, *chunked_slot(c, i - 1), descend) < 0;
+                 i--)
+                *chunked_slot(c, i) = *chunked_slot(c, i - 1);
+            *chunked_slot(c, i) = s;
+        }
+        return;
+    }
+
+    char **a = scratch, **p = a;
+    list_for_each_entry(k, &c->chunks, link) {
+        memcpy(p, &k->str[k->lo], chunk_count(k) * sizeof(char *));
+        p += chunk_count(k);
+    }
+    strings_sort(a, n, descend, a + n);
+    p = a;
+    list_for_each_entry(k, &c->chunks, link) {
+        memcpy(&k->str[k->lo], p, chunk_count(k) * sizeof(char *));
+        p += chunk_count(k);
+    }
+}
+
+/* Write s at the slot after *wi in chunk *w, moving on to the next chunk
+ * when *w is full
+ */
+static inline void chunked_put(struct chunk **w, unsigned *wi, char *s)
+{
+    if (*wi == (*w)->hi) {
+        *w = list_entry((*w)->link.next, struct chunk, link);
+        *wi = (*w)->lo;
+    }
+    (*w)->str[(*wi)++] = s;
+}
+
+/* Delete all strings that have a duplicate, in a sorted queue.  The strings
+ * kept are packed towards the head in one pass, writing through the same
+ * slots as it reads but never ahead of it, and the chunks left over at the
+ * tail are freed.
+ */
+bool q_chunked_delete_dup(chunked_t *c)
+{
+    if (!c || !c->size)
+        return false;
+
+    struct chunk *w = list_first_entry(&c->chunks, struct chunk, link), *k;
+    unsigned wi = w->lo;
+    char *prev = NULL;
+    bool dup = false;
+    size_t kept = 0;
+
+    list_for_each_entry(k, &c->chunks, link) {
+        for (unsigned i = k->lo; i < k->hi; i++) {
+            char *s = k->str[i];
+            if (prev && !strcmp(prev, s)) {
+                free(s);
+                dup = true;
+                continue;
+            }
+            if (dup) {
+                free(prev);
+            } else if (prev) {
+                chunked_put(&w, &wi, prev);
+                kept++;
+            }
+            prev = s;
+            dup = false;
+        }
+    }
+    if (dup) {
+        free(prev);
+    } else {
+        chunked_put(&w, &wi, prev);
+        kept++;
+    }
+
+    /* Free the chunks past the last slot written, w too if nothing was */
+    struct list_head *node = kept ? w->link.next : c->chunks.next;
+    if (kept)
+        w->hi = wi;
+    while (node != &c->chunks) {
+        struct list_head *next = node->next;
+        list_del(node);
+        free(list_entry(node, struct chunk, link));
+        node = next;
+    }
+    c->size = kept;
+    c->cur = NULL;
+    return true;
+}
+
+int q_chunked_merge(chunked_t **c,
+                    int n,
+                    bool descend,
+                    void *scratch,
+                    size_t size)
+{
+    if (!c || n < 1 || !c[0])
+        return 0;
+
+    for (int i = 1; i < n; i++) {
+        list_splice_tail_init(&c[i]->chunks, &c[0]->chunks);
+        c[0]->size += c[i]->size;
+        c[i]->size = 0;
+        c[i]->cur = NULL;
+    }
+    c[0]->cur = NULL;
+    q_chunked_sort(c[0], descend, scratch, size);
+    return (int) c[0]->size;
 }
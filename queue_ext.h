@@ -0,0 +1,429 @@
+#ifndef LAB0_QUEUE_EXT_H
+#define LAB0_QUEUE_EXT_H
+
+/* Queue operations beyond the interface of queue.h.
+ *
+ * queue.h is protected by scripts/checksums, so the additional entry points
+ * implemented in queue.c are declared here.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "queue.h"
+
+/* Number of threads q_sort() and q_merge() may use, 1 or less for none but
+ * the caller
+ */
+extern int q_threads;
+
+/* How q_merge() merges the queues: 0 for all at once through a heap, other
+ * values for pairwise in rounds
+ */
+extern int q_merge_mode;
+
+/* Called by a pairwise q_merge() after each round, numbered from 1, with the
+ * number of lists it started and ended with.  NULL for none.
+ */
+extern void (*q_merge_round)(int round, int from, int to);
+
+/* Whether q_reverse() only flips the reading direction of a queue */
+extern int q_lazy;
+
+/**
+ * q_materialize() - Make the links of the queue follow its order
+ * @head: header of queue
+ *
+ * With q_lazy set, q_reverse() leaves the links as they are and marks the
+ * queue as reading backwards.  The queue operations take care of that, but
+ * code walking or rearranging the list directly through the list.h
+ * operations has to call this function first.  No effect if queue is NULL
+ * or already in order.
+ */
+void q_materialize(struct list_head *head);
+
+/**
+ * q_insert_tail_n() - Insert an element of known length at the tail
+ * @head: header of queue
+ * @s: string would be inserted
+ * @len: number of bytes of @s to store
+ *
+ * Like q_insert_tail(), but copies exactly the first @len bytes of @s and
+ * null-terminates the copy, so callers that already know the length skip
+ * the strlen() scan.
+ *
+ * Return: true for success, false for allocation failed or queue is NULL
+ */
+bool q_insert_tail_n(struct list_head *head, const char *s, size_t len);
+
+/**
+ * q_insert_head_bulk() - Insert a batch of elements at the head
+ * @head: header of queue
+ * @s: array of strings would be inserted
+ * @n: number of strings in @s
+ *
+ * Has the same effect as calling q_insert_head() on s[0], s[1], ...,
+ * s[n - 1] in turn, so s[n - 1] ends up first, without going through the
+ * per-call checks for each string.  A string whose element cannot be
+ * allocated is skipped.
+ *
+ * Return: the number of elements inserted
+ */
+int q_insert_head_bulk(struct list_head *head, char **s, int n);
+
+/**
+ * q_insert_tail_bulk() - Insert a batch of elements at the tail
+ * @head: header of queue
+ * @s: array of strings would be inserted
+ * @n: number of strings in @s
+ *
+ * Has the same effect as calling q_insert_tail() on s[0], s[1], ...,
+ * s[n - 1] in turn.  A string whose element cannot be allocated is skipped.
+ *
+ * Return: the number of elements inserted
+ */
+int q_insert_tail_bulk(struct list_head *head, char **s, int n);
+
+/**
+ * q_delete_dup_hash() - Delete all nodes that have duplicate string
+ * @head: header of queue
+ *
+ * Unlike q_delete_dup(), the queue does not have to be sorted: every string
+ * that appears more than once anywhere in the queue is deleted, and the
+ * remaining elements keep their order.  Runs in expected linear time using
+ * a temporary hash set, which is the only allocation made.
+ *
+ * Return: true for success, false if list is NULL or empty, or if the set
+ * could not be allocated, in which case the queue is left unchanged.
+ */
+bool q_delete_dup_hash(struct list_head *head);
+
+/**
+ * q_sort_array_scratch() - Size of the scratch area q_sort_array() needs
+ * @n: number of elements in the queue
+ *
+ * Return: the size in bytes
+ */
+size_t q_sort_array_scratch(size_t n);
+
+/**
+ * q_sort_array() - Sort elements of queue through a contiguous array
+ * @head: header of queue
+ * @descend: whether or not to sort in descending order
+ * @scratch: caller-provided buffer, suitably aligned for any type
+ * @size: size of @scratch in bytes
+ *
+ * Sorts like q_sort(), and just as stably, but works on an array of node
+ * pointers and 8-byte key prefixes kept in @scratch, so the heap is not
+ * chased on most comparisons.  With @size less than
+ * q_sort_array_scratch(q_size(@head)) it falls back to q_sort().  This
+ * function does not allocate.
+ */
+void q_sort_array(struct list_head *head,
+                  bool descend,
+                  void *scratch,
+                  size_t size);
+
+/**
+ * q_sort_radix() - Sort elements of queue by MSD radix sort
+ * @head: header of queue
+ * @descend: whether or not to sort in descending order
+ *
+ * Sorts like q_sort(), and just as stably, by distributing the elements on
+ * one byte of their strings at a time instead of comparing whole strings.
+ * No effect if queue is NULL or empty.  This function does not allocate.
+ */
+void q_sort_radix(struct list_head *head, bool descend);
+
+/**
+ * list_sort_keyed_scratch() - Size of the scratch area list_sort_keyed() needs
+ * @n: number of elements in the queue
+ *
+ * Return: the size in bytes
+ */
+size_t list_sort_keyed_scratch(size_t n);
+
+/**
+ * list_sort_keyed() - Sort elements of queue by list_sort() on cached keys
+ * @head: header of queue
+ * @descend: whether or not to sort in descending order
+ * @scratch: caller-provided buffer, suitably aligned for any type
+ * @size: size of @scratch in bytes
+ *
+ * Runs list_sort() on stand-ins for the elements kept in @scratch, each
+ * holding the first 8 bytes of its string as an integer key, so strcmp() is
+ * only needed on ties.  The sort is stable.  With @size less than
+ * list_sort_keyed_scratch(q_size(@head)) it falls back to list_sort() with
+ * cmp(), or its reverse for @descend.  This function does not allocate.
+ */
+void list_sort_keyed(struct list_head *head,
+                     bool descend,
+                     void *scratch,
+                     size_t size);
+
+/**
+ * q_shuffle() - Shuffle the elements of the queue at random
+ * @head: header of queue
+ * @state: state of the pseudo-random generator, advanced by the shuffle
+ *
+ * Runs Fisher-Yates on the draws of a splitmix generator, so the shuffle is
+ * as uniform as the generator: the permutations reachable are at most the
+ * 2^64 (2^32 on 32-bit targets) sequences of draws, every one of them for
+ * short queues but a vanishing fraction of the n! ones of long queues.
+ * Keep @state from one call to the next rather than reseeding each time.
+ * The same state always yields the same permutation.  No effect if queue is
+ * NULL, empty or has only one element.  This function does not allocate.
+ */
+void q_shuffle(struct list_head *head, uintptr_t *state);
+
+/* Queue of strings in a growable ring buffer, for workloads that only
+ * insert and remove at the ends.  It has no nodes, so it offers the subset
+ * of the queue operations below instead of the interface of queue.h.
+ */
+typedef struct ring ring_t;
+
+/**
+ * q_ring_new() - Create an empty ring buffer queue
+ *
+ * Return: NULL for allocation failed
+ */
+ring_t *q_ring_new(void);
+
+/**
+ * q_ring_free() - Free all storage used by ring buffer queue
+ * @r: ring buffer queue to be deallocated
+ */
+void q_ring_free(ring_t *r);
+
+/**
+ * q_ring_insert_head() - Insert a copy of a string at the head
+ * @r: ring buffer queue
+ * @s: string would be inserted
+ *
+ * Takes O(1) amortized time: the ring doubles its capacity when full.
+ *
+ * Return: true for success, false for allocation failed or ring is NULL
+ */
+bool q_ring_insert_head(ring_t *r, const char *s);
+
+/**
+ * q_ring_insert_tail() - Insert a copy of a string at the tail
+ * @r: ring buffer queue
+ * @s: string would be inserted
+ *
+ * Return: true for success, false for allocation failed or ring is NULL
+ */
+bool q_ring_insert_tail(ring_t *r, const char *s);
+
+/**
+ * q_ring_remove_head() - Remove and free the string at the head
+ * @r: ring buffer queue
+ * @sp: output buffer where the removed string is copied, or NULL
+ * @bufsize: size of @sp
+ *
+ * Copies the string like q_remove_head() before freeing it.
+ *
+ * Return: true for success, false if ring is NULL or empty
+ */
+bool q_ring_remove_head(ring_t *r, char *sp, size_t bufsize);
+
+/**
+ * q_ring_remove_tail() - Remove and free the string at the tail
+ * @r: ring buffer queue
+ * @sp: output buffer where the removed string is copied, or NULL
+ * @bufsize: size of @sp
+ *
+ * Return: true for success, false if ring is NULL or empty
+ */
+bool q_ring_remove_tail(ring_t *r, char *sp, size_t bufsize);
+
+/**
+ * q_ring_size() - Get the number of strings in ring buffer queue
+ * @r: ring buffer queue
+ *
+ * Return: the number of strings, 0 if ring is NULL
+ */
+int q_ring_size(const ring_t *r);
+
+/**
+ * q_ring_at() - Get a string of ring buffer queue
+ * @r: ring buffer queue
+ * @i: position of the string, 0 for the head
+ *
+ * Return: the string, NULL if @i is out of range
+ */
+const char *q_ring_at(const ring_t *r, int i);
+
+/**
+ * q_ring_reverse() - Reverse the strings of ring buffer queue in place
+ * @r: ring buffer queue
+ */
+void q_ring_reverse(ring_t *r);
+
+/**
+ * q_ring_swap() - Swap every two adjacent strings of ring buffer queue
+ * @r: ring buffer queue
+ */
+void q_ring_swap(ring_t *r);
+
+/**
+ * q_ring_sort_scratch() - Size of the scratch area q_ring_sort() needs
+ * @n: number of strings in the ring
+ *
+ * Return: the size in bytes
+ */
+size_t q_ring_sort_scratch(size_t n);
+
+/**
+ * q_ring_sort() - Sort the strings of ring buffer queue
+ * @r: ring buffer queue
+ * @descend: whether or not to sort in descending order
+ * @scratch: caller-provided buffer, suitably aligned for any type
+ * @size: size of @scratch in bytes
+ *
+ * Stable merge sort of the string pointers in the ring.  With @size less
+ * than q_ring_sort_scratch(q_ring_size(@r)) it falls back to insertion
+ * sort.  This function does not allocate.
+ */
+void q_ring_sort(ring_t *r, bool descend, void *scratch, size_t size);
+
+/* Queue of strings in an unrolled linked list: chunks of string pointers
+ * linked together, so walking the queue touches one chunk per few dozen
+ * strings instead of one node per string.  Like the ring buffer queue, it
+ * offers the subset of the queue operations below.
+ */
+typedef struct chunked chunked_t;
+
+/**
+ * q_chunked_new() - Create an empty chunked queue
+ *
+ * Return: NULL for allocation failed
+ */
+chunked_t *q_chunked_new(void);
+
+/**
+ * q_chunked_free() - Free all storage used by chunked queue
+ * @c: chunked queue to be deallocated
+ */
+void q_chunked_free(chunked_t *c);
+
+/**
+ * q_chunked_insert_head() - Insert a copy of a string at the head
+ * @c: chunked queue
+ * @s: string would be inserted
+ *
+ * Return: true for success, false for allocation failed or queue is NULL
+ */
+bool q_chunked_insert_head(chunked_t *c, const char *s);
+
+/**
+ * q_chunked_insert_tail() - Insert a copy of a string at the tail
+ * @c: chunked queue
+ * @s: string would be inserted
+ *
+ * Return: true for success, false for allocation failed or queue is NULL
+ */
+bool q_chunked_insert_tail(chunked_t *c, const char *s);
+
+/**
+ * q_chunked_remove_head() - Remove and free the string at the head
+ * @c: chunked queue
+ * @sp: output buffer where the removed string is copied, or NULL
+ * @bufsize: size of @sp
+ *
+ * Copies the string like q_remove_head() before freeing it.
+ *
+ * Return: true for success, false if queue is NULL or empty
+ */
+bool q_chunked_remove_head(chunked_t *c, char *sp, size_t bufsize);
+
+/**
+ * q_chunked_remove_tail() - Remove and free the string at the tail
+ * @c: chunked queue
+ * @sp: output buffer where the removed string is copied, or NULL
+ * @bufsize: size of @sp
+ *
+ * Return: true for success, false if queue is NULL or empty
+ */
+bool q_chunked_remove_tail(chunked_t *c, char *sp, size_t bufsize);
+
+/**
+ * q_chunked_size() - Get the number of strings in chunked queue
+ * @c: chunked queue
+ *
+ * Return: the number of strings, 0 if queue is NULL
+ */
+int q_chunked_size(const chunked_t *c);
+
+/**
+ * q_chunked_at() - Get a string of chunked queue
+ * @c: chunked queue
+ * @i: position of the string, 0 for the head
+ *
+ * Takes O(1) time for positions near either end or next to the one looked
+ * up last, so walking the queue in order is linear.
+ *
+ * Return: the string, NULL if @i is out of range
+ */
+const char *q_chunked_at(chunked_t *c, int i);
+
+/**
+ * q_chunked_reverse() - Reverse the strings of chunked queue in place
+ * @c: chunked queue
+ */
+void q_chunked_reverse(chunked_t *c);
+
+/**
+ * q_chunked_sort_scratch() - Size of the scratch area q_chunked_sort() needs
+ * @n: number of strings in the queue
+ *
+ * Return: the size in bytes
+ */
+size_t q_chunked_sort_scratch(size_t n);
+
+/**
+ * q_chunked_sort() - Sort the strings of chunked queue
+ * @c: chunked queue
+ * @descend: whether or not to sort in descending order
+ * @scratch: caller-provided buffer, suitably aligned for any type
+ * @size: size of @scratch in bytes
+ *
+ * Stable merge sort of the string pointers.  With @size less than
+ * q_chunked_sort_scratch(q_chunked_size(@c)) it falls back to insertion
+ * sort.  This function does not allocate.
+ */
+void q_chunked_sort(chunked_t *c, bool descend, void *scratch, size_t size);
+
+/**
+ * q_chunked_delete_dup() - Delete all strings that have a duplicate
+ * @c: chunked queue, sorted
+ *
+ * Like q_delete_dup(): every string equal to its neighbour is deleted.
+ *
+ * Return: true for success, false if queue is NULL or empty
+ */
+bool q_chunked_delete_dup(chunked_t *c);
+
+/**
+ * q_chunked_merge() - Merge sorted chunked queues into the first one
+ * @c: array of chunked queues
+ * @n: number of queues in @c
+ * @descend: whether the queues are sorted in descending order
+ * @scratch: caller-provided buffer, suitably aligned for any type
+ * @size: size of @scratch in bytes
+ *
+ * The chunks of all the queues are spliced onto @c[0] and its strings are
+ * sorted stably by q_chunked_sort(), so @scratch should hold
+ * q_chunked_sort_scratch() of the total size.  The other queues are left
+ * empty.  This function does not allocate.
+ *
+ * Return: the number of strings in @c[0]
+ */
+int q_chunked_merge(chunked_t **c,
+                    int n,
+                    bool descend,
+                    void *scratch,
+                    size_t size);
+
+#endif /* LAB0_QUEUE_EXT_H */
@@ -0,0 +1,10 @@
+# Test the performance of 'arraysort' on 8 * 10^5 elements, as in
+# trace-q_sort_per_eval, then on the same elements once shuffled
+option fail 0
+option malloc 0
+new
+ih RAND 800000
+time arraysort
+shuffle 1
+time arraysort
+free
@@ -0,0 +1,22 @@
+# Test that 'q_ascend' and 'q_descend' finish in linear time on 10^6 elements
+option fail 0
+option malloc 0
+new
+ih RAND 1000000
+ascend
+free
+new
+ih RAND 1000000
+descend
+free
+# A single small (large) value at the tail removes every other node
+new
+it b 1000000
+it a
+ascend
+free
+new
+it b 1000000
+it c
+descend
+free
@@ -0,0 +1,28 @@
+# Test the performance of listsort from Linux kernel with the branching and
+# the branchless merge kernels, reporting cycles and, where perf events are
+# available, branch misses of each sort
+option fail 0
+option malloc 0
+option verbose 2
+option time 10
+option branchless 0
+new
+ih RAND 800000
+listsort
+free
+option branchless 1
+new
+ih RAND 800000
+listsort
+free
+option keycache 1
+option branchless 0
+new
+ih RAND 800000
+listsort
+free
+option branchless 1
+new
+ih RAND 800000
+listsort
+free
@@ -0,0 +1,13 @@
+# Test the cost of checking every free against checking every 1000th free
+# and sweeping 1/1000 of the allocated blocks after each command
+option fail 0
+option malloc 0
+option cautious_rate 0
+new
+ih RAND 1000000
+time free
+option cautious_rate 1000
+new
+ih RAND 1000000
+time free
+option cautious_rate 0
@@ -0,0 +1,31 @@
+# Compare list queues against chunked queues, whose strings sit in arrays
+# of the chunks of an unrolled list: the time of each operation, and the
+# blocks each of them holds per string
+option fail 0
+option malloc 0
+new
+time ih dolphin 500000
+time it gerbil 500000
+allocs live
+time reverse
+time rh gerbil
+time rt dolphin
+time dedup
+time free
+new
+ih RAND 100000
+time sort
+time free
+new chunked
+time ih dolphin 500000
+time it gerbil 500000
+allocs live
+time reverse
+time rh gerbil
+time rt dolphin
+time dedup
+time free
+new chunked
+ih RAND 100000
+time sort
+time free
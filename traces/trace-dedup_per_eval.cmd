@@ -0,0 +1,11 @@
+# Test performance of dedup on a large unsorted queue
+option fail 0
+option malloc 0
+new
+ih RAND 500000
+it dolphin 100000
+ih RAND 300000
+it bear 100000
+ih RAND 100000
+time dedup hash
+free
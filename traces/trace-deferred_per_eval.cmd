@@ -0,0 +1,22 @@
+# Test if qtest recovers from the time limit expiring while it allocates
+# with helper threads enabled, failing some of the allocations too.  The
+# alarm mostly lands while a shard lock is held, so the exception is held
+# back until the lock is released.  The queue is then sorted and merged on
+# 4 threads, which must find it intact.  Only the element being built when
+# the time limit expires is left over, and reported as still allocated.
+option fail 10000000
+option malloc 1
+option threads 4
+option time 1
+new
+ih RAND 5000000
+size
+option time 0
+sort
+new
+ih RAND 100000
+sort
+merge
+size
+option malloc 0
+free
@@ -0,0 +1,12 @@
+# Measure the cost of the string copy in 'q_insert_head' and 'q_insert_tail'
+# Each command performs 10^6 insertions, so Delta time in ms equals ns/op.
+option fail 0
+option malloc 0
+new
+time it dolphin 1000000
+time ih dolphin 1000000
+free
+new
+time it abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefgh 1000000
+time ih abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefgh 1000000
+free
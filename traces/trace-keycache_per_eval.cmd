@@ -0,0 +1,15 @@
+# Test the performance of listsort from Linux kernel with and without cached
+# key prefixes, reporting the cycles each sort takes
+option fail 0
+option malloc 0
+option verbose 2
+option keycache 0
+new
+ih RAND 800000
+listsort
+free
+option keycache 1
+new
+ih RAND 800000
+listsort
+free
@@ -0,0 +1,78 @@
+# Test if listsort orders a queue the same way with and without cached key
+# prefixes, checking the order in both directions
+option fail 0
+option malloc 0
+option descend 1
+option keycache 0
+new
+it abcdefghij2
+it zebra
+it abcdefgh
+it gerbil
+it abcdefghij10
+it ant
+it abcdefghij2
+listsort
+rh zebra
+rh gerbil
+rh ant
+rh abcdefghij2
+rh abcdefghij2
+rh abcdefghij10
+rh abcdefgh
+free
+option keycache 1
+new
+it abcdefghij2
+it zebra
+it abcdefgh
+it gerbil
+it abcdefghij10
+it ant
+it abcdefghij2
+listsort
+rh zebra
+rh gerbil
+rh ant
+rh abcdefghij2
+rh abcdefghij2
+rh abcdefghij10
+rh abcdefgh
+free
+option descend 0
+option keycache 0
+new
+it abcdefghij2
+it zebra
+it abcdefgh
+it gerbil
+it abcdefghij10
+it ant
+it abcdefghij2
+listsort
+rh abcdefgh
+rh abcdefghij10
+rh abcdefghij2
+rh abcdefghij2
+rh ant
+rh gerbil
+rh zebra
+free
+option keycache 1
+new
+it abcdefghij2
+it zebra
+it abcdefgh
+it gerbil
+it abcdefghij10
+it ant
+it abcdefghij2
+listsort
+rh abcdefgh
+rh abcdefghij10
+rh abcdefghij2
+rh abcdefghij2
+rh ant
+rh gerbil
+rh zebra
+free
@@ -0,0 +1,29 @@
+# Test the performance of 'q_reverse' with lazy reversal on 2 * 10^6
+# elements, followed by the operations that keep the reading direction
+option fail 0
+option malloc 0
+option lazy 1
+new
+ih dolphin 1000000
+it gerbil 1000000
+time reverse
+time reverse
+time reverse
+time rh
+time rt
+time sort
+time size
+free
+# A merge of unsorted queues must not leave the result marked as sorted
+new
+it a
+new
+ih bb
+it zzzzzzzzzz0 5
+ih ab
+merge
+sort
+rh a
+rh ab
+rh bb
+free
@@ -0,0 +1,6010 @@
+# Test the performance of 'q_merge' on 1000 sorted queues of 500 elements,
+# in ascending and then in descending order
+option fail 0
+option malloc 0
+option descend 0
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+time merge
+free
+option descend 1
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+new
+ih RAND 500
+sort
+time merge
+free
@@ -0,0 +1,2320 @@
+# Test the performance of 'q_merge' on 256 sorted queues of 1000 elements,
+# merged through a heap, pairwise, and pairwise on 4 threads
+option fail 0
+option malloc 0
+option mergemode 0
+option threads 1
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+time merge
+free
+option mergemode 1
+option threads 1
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+time merge
+free
+option mergemode 1
+option threads 4
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+time merge
+free
@@ -0,0 +1,26 @@
+# Compare the queue operations on blocks from the slab pool against plain
+# malloc: inserting, walking the nodes, and deleting and freeing them
+option fail 0
+option malloc 0
+option pool 0
+new
+time ih dolphin 1000000
+time it gerbil 1000000
+time reverse
+time dedup
+time free
+new
+ih RAND 100000
+time sort
+time free
+option pool 1
+new
+time ih dolphin 1000000
+time it gerbil 1000000
+time reverse
+time dedup
+time free
+new
+ih RAND 100000
+time sort
+time free
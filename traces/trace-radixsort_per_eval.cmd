@@ -0,0 +1,41 @@
+# Compare 'radixsort' with 'sort' and 'listsort' on 10^5, 10^6 and 10^7
+# elements, each run on a fresh queue of random strings
+option fail 0
+option malloc 0
+option time 120
+new
+ih RAND 100000
+time sort
+free
+new
+ih RAND 100000
+time listsort
+free
+new
+ih RAND 100000
+time radixsort
+free
+new
+ih RAND 1000000
+time sort
+free
+new
+ih RAND 1000000
+time listsort
+free
+new
+ih RAND 1000000
+time radixsort
+free
+new
+ih RAND 10000000
+time sort
+free
+new
+ih RAND 10000000
+time listsort
+free
+new
+ih RAND 10000000
+time radixsort
+free
@@ -0,0 +1,10 @@
+# Test the performance of 'q_reverseK' with k = 2, sqrt(n) and n on 10^6 elements
+option fail 0
+option malloc 0
+new
+ih RAND 1000000
+time reverseK 2
+time reverseK 1000
+time reverseK 1000000
+time reverseK 999999
+free
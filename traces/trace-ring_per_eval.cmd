@@ -0,0 +1,15 @@
+# Test the performance of ring buffer queues, which insert, remove, reverse
+# and sort without chasing nodes
+option fail 0
+option malloc 0
+new ring
+ih dolphin 500000
+it gerbil 500000
+time reverse
+time swap
+rh gerbil
+rt dolphin
+ih RAND 100000
+time sort
+size
+free
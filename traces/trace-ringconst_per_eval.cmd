@@ -0,0 +1,10 @@
+# Test if time complexity of the ring buffer queue operations is constant
+new ring
+option simulation 1
+ih
+it
+rh
+rt
+size
+option simulation 0
+free
@@ -0,0 +1,16 @@
+# Test the performance of 'q_sort' on 5 * 10^5 elements that are, in order:
+# random, sorted, reversed, sorted with 20 strays, and pairwise swapped
+option fail 0
+option malloc 0
+new
+ih RAND 500000
+time sort
+time sort
+reverse
+time sort
+ih RAND 10
+it RAND 10
+time sort
+swap
+time sort
+free
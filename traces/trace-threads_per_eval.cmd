@@ -0,0 +1,51 @@
+# Test the performance of 'q_sort' on 10^6 elements with 1, 2, 4 and 8
+# threads, each on a fresh queue of random strings
+option fail 0
+option malloc 0
+option time 10
+option threads 1
+new
+ih RAND 1000000
+time sort
+free
+option threads 2
+new
+ih RAND 1000000
+time sort
+free
+option threads 4
+new
+ih RAND 1000000
+time sort
+free
+option threads 8
+new
+ih RAND 1000000
+time sort
+free
+# Check the order and stability of the parallel sort on 60000 elements, most
+# of them duplicates of a few strings, with 2 and 8 threads
+option threads 2
+new
+ih gerbil 10000
+ih RAND 10000
+it dolphin 10000
+ih RAND 10000
+it gerbil 10000
+ih dolphin 10000
+sort
+ascend
+size
+free
+option threads 8
+new
+ih gerbil 10000
+ih RAND 10000
+it dolphin 10000
+ih RAND 10000
+it gerbil 10000
+ih dolphin 10000
+sort
+ascend
+size
+free
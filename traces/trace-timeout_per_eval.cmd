@@ -0,0 +1,11 @@
+# Test if qtest recovers from the time limit expiring in the middle of
+# allocations, and goes on with the next commands.  Only the element being
+# built when it expires is left over, and reported as still allocated.
+option fail 0
+option malloc 0
+option time 1
+new
+it a 30000000
+it b 10
+size
+free